@@ -0,0 +1,107 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "openvino/openvino.hpp"
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+// clang-format on
+
+using Ms = std::chrono::duration<double, std::ratio<1, 1000>>;
+
+namespace {
+void report_loading_time(const std::string& model_path, const ov::CompiledModel& compiled_model) {
+    slog::info << "    " << model_path << ":";
+    for (const auto& phase : compiled_model.get_property(ov::loading_time_details)) {
+        slog::info << " " << phase.first << " " << double_to_string(phase.second) << " ms";
+    }
+    slog::info << slog::endl;
+}
+
+// Compiles all the models one after another, returns the duration in milliseconds
+double compile_sequentially(const std::vector<std::string>& model_paths,
+                            const std::string& device_name,
+                            const ov::AnyMap& config) {
+    ov::Core core;
+    core.set_property(config);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ov::CompiledModel> compiled_models;
+    for (const auto& model_path : model_paths) {
+        compiled_models.push_back(core.compile_model(model_path, device_name));
+    }
+    auto duration = std::chrono::duration_cast<Ms>(std::chrono::steady_clock::now() - start).count();
+    for (size_t i = 0; i < model_paths.size(); i++) {
+        report_loading_time(model_paths[i], compiled_models[i]);
+    }
+    return duration;
+}
+
+// Queues all the models to ov::Core::compile_model_async and waits for them, returns the duration in milliseconds
+double compile_asynchronously(const std::vector<std::string>& model_paths,
+                              const std::string& device_name,
+                              const ov::AnyMap& config) {
+    ov::Core core;
+    core.set_property(config);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::future<ov::CompiledModel>> futures;
+    for (const auto& model_path : model_paths) {
+        futures.push_back(core.compile_model_async(model_path, device_name));
+    }
+    std::vector<ov::CompiledModel> compiled_models;
+    for (auto& future : futures) {
+        compiled_models.push_back(future.get());
+    }
+    auto duration = std::chrono::duration_cast<Ms>(std::chrono::steady_clock::now() - start).count();
+    for (size_t i = 0; i < model_paths.size(); i++) {
+        report_loading_time(model_paths[i], compiled_models[i]);
+    }
+    return duration;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        slog::info << "OpenVINO:" << slog::endl;
+        slog::info << ov::get_openvino_version();
+        if (argc < 3) {
+            slog::info << "Usage : " << argv[0] << " <device_name> <path_to_model> [<path_to_model> ...]"
+                       << slog::endl;
+            return EXIT_FAILURE;
+        }
+        const std::string device_name = argv[1];
+        const std::vector<std::string> model_paths(argv + 2, argv + argc);
+        // Every mode creates its own ov::Core, so models compiled by the previous modes are not reused.
+        // The cache directory is filled by the first compilation with the cache enabled.
+        const ov::AnyMap no_cache{ov::cache_dir("")};
+        const ov::AnyMap cache{ov::cache_dir("startup_benchmark_cache")};
+
+        std::vector<std::pair<std::string, double>> durations;
+        slog::info << "Compile " << model_paths.size() << " models sequentially without cache:" << slog::endl;
+        durations.emplace_back("Sequential, no cache", compile_sequentially(model_paths, device_name, no_cache));
+        slog::info << "Compile " << model_paths.size() << " models asynchronously without cache:" << slog::endl;
+        durations.emplace_back("Async, no cache", compile_asynchronously(model_paths, device_name, no_cache));
+        slog::info << "Compile " << model_paths.size() << " models asynchronously to fill the cache:" << slog::endl;
+        compile_asynchronously(model_paths, device_name, cache);
+        slog::info << "Import " << model_paths.size() << " models sequentially from cache:" << slog::endl;
+        durations.emplace_back("Sequential, cache", compile_sequentially(model_paths, device_name, cache));
+        slog::info << "Import " << model_paths.size() << " models asynchronously from cache:" << slog::endl;
+        durations.emplace_back("Async, cache", compile_asynchronously(model_paths, device_name, cache));
+
+        // Report results
+        slog::info << "Startup time:" << slog::endl;
+        for (const auto& duration : durations) {
+            slog::info << "    " << duration.first << ": " << double_to_string(duration.second) << " ms" << slog::endl;
+        }
+    } catch (const std::exception& ex) {
+        slog::err << ex.what() << slog::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -90,6 +90,32 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for open-loop arrival rate
+static const char arrival_rate_message[] =
+    "Optional. Enables open-loop load: inference requests arrive as a Poisson process with the given average rate "
+    "(requests per second) independently of completion of previous requests. Latency is measured from the "
+    "scheduled arrival time, so the time spent waiting for an idle infer request is included.";
+
+/// @brief message for open-loop arrival trace
+static const char arrival_trace_message[] =
+    "Optional. Enables open-loop load replaying arrival timestamps from the given text file: one timestamp in "
+    "milliseconds per line. The run stops at the end of the trace or at the -t/-niter limit, whichever comes first.";
+
+/// @brief message for co-located models manifest
+static const char models_config_message[] =
+    "Optional. Path to JSON manifest of models to benchmark co-located on one OpenVINO Runtime core instead of -m. "
+    "The manifest is an array of objects with \"model\" path and optional \"device\", \"arrival_rate\" "
+    "(requests per second) or \"share\" of -arrival_rate, \"nireq\" and \"config\" (compile properties) fields. "
+    "Property values may be strings, numbers, booleans or objects of device properties. "
+    "Every model runs alone and then all models run concurrently for -t seconds each.";
+
+/// @brief message for latency SLO search
+static const char latency_slo_message[] =
+    "Optional. Searches for the maximal open-loop arrival rate at which the 99th percentile latency does not exceed "
+    "the given value in milliseconds. Every search step is a probe run limited to a tenth of -t (at least 1 second) "
+    "or of -niter (at least 100 iterations), the found rate is confirmed by a run with the full -t/-niter limits. "
+    "The search starts from -arrival_rate if it is set.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -309,6 +335,18 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint64(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Average arrival rate of requests in open-loop mode
+DEFINE_double(arrival_rate, 0, arrival_rate_message);
+
+/// @brief Path to the arrival timestamps of requests in open-loop mode
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
+/// @brief Path to the manifest of co-located models
+DEFINE_string(models_config, "", models_config_message);
+
+/// @brief 99th percentile latency objective for the arrival rate search
+DEFINE_double(latency_slo, 0, latency_slo_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint64(b, 0, batch_size_message);
@@ -414,6 +452,10 @@ static void show_usage() {
     std::cout << "    -cache_dir  <path>            " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file               " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile           " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -arrival_rate  <float>        " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival_trace  <path>        " << arrival_trace_message << std::endl;
+    std::cout << "    -latency_slo  <float>         " << latency_slo_message << std::endl;
+    std::cout << "    -models_config  <path>        " << models_config_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams  <integer>          " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads  <integer>          " << infer_num_threads_message << std::endl;
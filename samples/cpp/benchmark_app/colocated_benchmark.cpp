@@ -0,0 +1,333 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// clang-format off
+#include "samples/slog.hpp"
+
+#include "colocated_benchmark.hpp"
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "utils.hpp"
+// clang-format on
+
+#ifdef JSON_HEADER
+#    include <json.hpp>
+#else
+#    include <nlohmann/json.hpp>
+#endif
+
+namespace {
+struct ColocatedModel {
+    ColocatedModelConfig config;
+    ov::CompiledModel compiled_model;
+    std::unique_ptr<InferRequestsQueue> queue;
+};
+
+struct RunResult {
+    std::vector<double> latencies;
+    double duration_ms = 0;
+    size_t iterations = 0;
+
+    double percentile(double value) const {
+        return latencies.empty() ? 0 : get_latency_percentile(latencies, value);
+    }
+
+    double throughput() const {
+        return duration_ms > 0 ? 1000.0 * iterations / duration_ms : 0;
+    }
+};
+
+/// @brief Returns current and peak resident set size of the process in kilobytes, zeros if it is unknown
+std::pair<size_t, size_t> get_resident_memory_kb() {
+    size_t current = 0;
+    size_t peak = 0;
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        std::istringstream fields(line);
+        std::string key;
+        if (line.rfind("VmRSS:", 0) == 0) {
+            fields >> key >> current;
+        } else if (line.rfind("VmHWM:", 0) == 0) {
+            fields >> key >> peak;
+        }
+    }
+#endif
+    return {current, peak};
+}
+
+/// @brief Converts JSON value of a compile property. Strings and booleans keep their types, objects become nested
+/// property maps. Numbers keep their JSON text, which the device converts to the declared type of the property,
+/// so the same manifest works for int32, uint32 and floating point properties
+ov::Any json_to_property_value(const nlohmann::json& value) {
+    if (value.is_object()) {
+        ov::AnyMap properties;
+        for (const auto& item : value.items()) {
+            properties[item.key()] = json_to_property_value(item.value());
+        }
+        return properties;
+    }
+    if (value.is_string()) {
+        return value.get<std::string>();
+    }
+    if (value.is_boolean()) {
+        return value.get<bool>();
+    }
+    if (value.is_number()) {
+        return value.dump();
+    }
+    throw std::runtime_error("Unsupported value of compile property in co-located models manifest: " + value.dump());
+}
+
+/// @brief Runs the model with open-loop load if the arrival rate is set and with closed-loop load otherwise
+RunResult run_model(ColocatedModel& model, uint64_t duration_nanoseconds) {
+    auto& queue = *model.queue;
+    queue.reset_times();
+
+    RunResult result;
+    const double arrival_rate = model.config.arrival_rate;
+    std::mt19937 generator(42);
+    std::exponential_distribution<double> inter_arrival_ms(arrival_rate > 0 ? arrival_rate / 1000.0 : 1.0);
+    const auto start_time = Time::now();
+    double arrival_ms = 0;
+    while (true) {
+        if (arrival_rate > 0) {
+            if (result.iterations != 0) {
+                arrival_ms += inter_arrival_ms(generator);
+            }
+            if (arrival_ms * 1000000.0 >= duration_nanoseconds) {
+                break;
+            }
+            const auto arrival_time = start_time + std::chrono::duration_cast<Time::duration>(
+                                                       std::chrono::duration<double, std::milli>(arrival_ms));
+            std::this_thread::sleep_until(arrival_time);
+            queue.get_idle_request()->start_async(arrival_time);
+        } else {
+            if (static_cast<uint64_t>(std::chrono::duration_cast<ns>(Time::now() - start_time).count()) >=
+                duration_nanoseconds) {
+                break;
+            }
+            queue.get_idle_request()->start_async();
+        }
+        ++result.iterations;
+    }
+    queue.wait_all();
+
+    result.latencies = queue.get_latencies();
+    result.duration_ms = queue.get_duration_in_milliseconds();
+    return result;
+}
+
+/// @brief Runs the models concurrently, each from its own thread
+std::vector<RunResult> run_models(std::vector<ColocatedModel>& models, uint64_t duration_nanoseconds) {
+    std::vector<RunResult> results(models.size());
+    std::vector<std::exception_ptr> exceptions(models.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < models.size(); ++i) {
+        threads.emplace_back([&, i] {
+            try {
+                results[i] = run_model(models[i], duration_nanoseconds);
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+    return results;
+}
+}  // namespace
+
+std::vector<ColocatedModelConfig> load_colocated_models(const std::string& filename, double total_arrival_rate) {
+    std::ifstream ifs(filename);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("Can't open co-located models manifest \"" + filename + "\".");
+    }
+    nlohmann::json manifest;
+    ifs >> manifest;
+    if (!manifest.is_array() || manifest.empty()) {
+        throw std::runtime_error("Co-located models manifest \"" + filename + "\" must be a non-empty JSON array.");
+    }
+
+    std::vector<ColocatedModelConfig> models;
+    for (const auto& item : manifest) {
+        ColocatedModelConfig model;
+        model.model = item.at("model").get<std::string>();
+        if (item.contains("device")) {
+            model.device = item.at("device").get<std::string>();
+        }
+        if (item.contains("arrival_rate")) {
+            model.arrival_rate = item.at("arrival_rate").get<double>();
+        } else if (item.contains("share")) {
+            if (total_arrival_rate <= 0) {
+                throw std::logic_error("\"share\" of arrival rate of model \"" + model.model +
+                                       "\" requires -arrival_rate option to be set.");
+            }
+            model.arrival_rate = item.at("share").get<double>() * total_arrival_rate;
+        }
+        if (item.contains("nireq")) {
+            model.nireq = item.at("nireq").get<size_t>();
+        }
+        if (item.contains("config")) {
+            for (const auto& property : item.at("config").items()) {
+                if (property.key() != "DEVICE_PROPERTIES") {
+                    model.properties[property.key()] = json_to_property_value(property.value());
+                    continue;
+                }
+                // secondary properties of devices, the same as in the -load_config file
+                if (!property.value().is_object()) {
+                    throw std::runtime_error("DEVICE_PROPERTIES of model \"" + model.model + "\" must be an object.");
+                }
+                for (const auto& device_properties : property.value().items()) {
+                    model.properties[device_properties.key()] = json_to_property_value(device_properties.value());
+                }
+            }
+        }
+        models.push_back(std::move(model));
+    }
+    return models;
+}
+
+void run_colocated_benchmark(ov::Core& core,
+                             const std::vector<ColocatedModelConfig>& configs,
+                             uint64_t duration_seconds,
+                             const std::shared_ptr<StatisticsReport>& statistics) {
+    std::vector<ColocatedModel> models;
+    models.reserve(configs.size());
+    for (size_t i = 0; i < configs.size(); ++i) {
+        ColocatedModel model;
+        model.config = configs[i];
+        auto start_time = Time::now();
+        model.compiled_model = core.compile_model(model.config.model, model.config.device, model.config.properties);
+        slog::info << "Model " << i << " (" << model.config.model << ") is compiled for " << model.config.device
+                   << " in " << double_to_string(get_duration_ms_till_now(start_time)) << " ms" << slog::endl;
+
+        for (const auto& input : model.compiled_model.inputs()) {
+            if (input.get_partial_shape().is_dynamic()) {
+                throw std::logic_error("Co-located benchmark doesn't support models with dynamic input shapes: " +
+                                       model.config.model);
+            }
+        }
+        size_t nireq = model.config.nireq;
+        if (nireq == 0) {
+            nireq = model.compiled_model.get_property(ov::optimal_number_of_infer_requests);
+        }
+        model.queue.reset(new InferRequestsQueue(model.compiled_model, nireq, 1, false));
+
+        auto inputs_info = get_inputs_info("", "", 0, "", {}, "", "", model.compiled_model.inputs());
+        auto tensors = get_tensors({}, inputs_info);
+        for (auto& request : model.queue->requests) {
+            for (const auto& item : tensors) {
+                auto request_tensor = request->get_tensor(item.first);
+                copy_tensor_data(request_tensor, item.second.front());
+            }
+        }
+
+        if (statistics) {
+            const auto prefix = "model" + std::to_string(i) + "_";
+            statistics->add_parameters(
+                StatisticsReport::Category::RUNTIME_CONFIG,
+                {StatisticsVariant("model " + std::to_string(i), prefix + "path", model.config.model),
+                 StatisticsVariant("model " + std::to_string(i) + " device", prefix + "device", model.config.device),
+                 StatisticsVariant("model " + std::to_string(i) + " infer requests", prefix + "nireq", nireq),
+                 StatisticsVariant("model " + std::to_string(i) + " arrival rate (requests/s)",
+                                   prefix + "arrival_rate",
+                                   model.config.arrival_rate)});
+        }
+        models.push_back(std::move(model));
+    }
+    const auto memory_after_compilation = get_resident_memory_kb();
+
+    const auto duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
+    std::vector<RunResult> isolated_results;
+    for (size_t i = 0; i < models.size(); ++i) {
+        slog::info << "Running model " << i << " alone for " << duration_seconds << " s" << slog::endl;
+        isolated_results.push_back(run_model(models[i], duration_nanoseconds));
+    }
+
+    slog::info << "Running " << models.size() << " models concurrently for " << duration_seconds << " s"
+               << slog::endl;
+    auto start_time = Time::now();
+    auto colocated_results = run_models(models, duration_nanoseconds);
+    const double colocated_duration_ms = get_duration_ms_till_now(start_time);
+    const auto memory_after_run = get_resident_memory_kb();
+
+    size_t total_iterations = 0;
+    for (size_t i = 0; i < models.size(); ++i) {
+        const auto& isolated = isolated_results[i];
+        const auto& colocated = colocated_results[i];
+        total_iterations += colocated.iterations;
+        const double isolated_p99 = isolated.percentile(99);
+        const double colocated_p99 = colocated.percentile(99);
+        const double interference = isolated_p99 > 0 ? colocated_p99 / isolated_p99 : 0;
+
+        slog::info << "Model " << i << " (" << models[i].config.model << "):" << slog::endl;
+        slog::info << "   Isolated:   median " << double_to_string(isolated.percentile(50)) << " ms, 99 percentile "
+                   << double_to_string(isolated_p99) << " ms, " << double_to_string(isolated.throughput()) << " FPS"
+                   << slog::endl;
+        slog::info << "   Co-located: median " << double_to_string(colocated.percentile(50)) << " ms, 99 percentile "
+                   << double_to_string(colocated_p99) << " ms, " << double_to_string(colocated.throughput())
+                   << " FPS" << slog::endl;
+        slog::info << "   99 percentile latency increase: x" << double_to_string(interference) << slog::endl;
+
+        if (statistics) {
+            const auto prefix = "model" + std::to_string(i) + "_";
+            const auto name = "model " + std::to_string(i) + " ";
+            statistics->add_parameters(
+                StatisticsReport::Category::EXECUTION_RESULTS,
+                {StatisticsVariant(name + "isolated median latency (ms)",
+                                   prefix + "isolated_latency_p50",
+                                   isolated.percentile(50)),
+                 StatisticsVariant(name + "isolated 99 percentile latency (ms)",
+                                   prefix + "isolated_latency_p99",
+                                   isolated_p99),
+                 StatisticsVariant(name + "isolated throughput", prefix + "isolated_throughput", isolated.throughput()),
+                 StatisticsVariant(name + "co-located median latency (ms)",
+                                   prefix + "latency_p50",
+                                   colocated.percentile(50)),
+                 StatisticsVariant(name + "co-located 99 percentile latency (ms)",
+                                   prefix + "latency_p99",
+                                   colocated_p99),
+                 StatisticsVariant(name + "co-located 99.9 percentile latency (ms)",
+                                   prefix + "latency_p99_9",
+                                   colocated.percentile(99.9)),
+                 StatisticsVariant(name + "co-located throughput", prefix + "throughput", colocated.throughput()),
+                 StatisticsVariant(name + "99 percentile latency increase", prefix + "interference", interference)});
+        }
+    }
+
+    const double aggregate_throughput = 1000.0 * total_iterations / colocated_duration_ms;
+    slog::info << "Aggregate throughput: " << double_to_string(aggregate_throughput) << " FPS" << slog::endl;
+    slog::info << "Resident memory after compilation: " << memory_after_compilation.first
+               << " KB, after run: " << memory_after_run.first << " KB, peak: " << memory_after_run.second << " KB"
+               << slog::endl;
+    if (statistics) {
+        statistics->add_parameters(
+            StatisticsReport::Category::EXECUTION_RESULTS,
+            {StatisticsVariant("aggregate throughput", "throughput", aggregate_throughput),
+             StatisticsVariant("resident memory after compilation (KB)",
+                               "rss_after_compilation_kb",
+                               memory_after_compilation.first),
+             StatisticsVariant("resident memory after run (KB)", "rss_after_run_kb", memory_after_run.first),
+             StatisticsVariant("peak resident memory (KB)", "rss_peak_kb", memory_after_run.second)});
+    }
+}
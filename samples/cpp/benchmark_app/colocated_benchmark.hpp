@@ -0,0 +1,45 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <openvino/openvino.hpp>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "statistics_report.hpp"
+// clang-format on
+
+/// @brief Parameters of one model of the co-located benchmark
+struct ColocatedModelConfig {
+    std::string model;
+    std::string device = "CPU";
+    double arrival_rate = 0;  //!< requests per second, zero means closed-loop load
+    size_t nireq = 0;         //!< zero means ov::optimal_number_of_infer_requests of the compiled model
+    ov::AnyMap properties;    //!< properties passed to ov::Core::compile_model, e.g. performance hint
+};
+
+/// <summary>
+/// Reads the manifest of co-located models: JSON array of objects with "model" path and optional "device",
+/// "arrival_rate" (requests per second) or "share" of total_arrival_rate, "nireq" and "config" properties
+/// </summary>
+/// <param name="filename">path to the manifest</param>
+/// <param name="total_arrival_rate">arrival rate distributed between models by their "share" values</param>
+std::vector<ColocatedModelConfig> load_colocated_models(const std::string& filename, double total_arrival_rate);
+
+/// <summary>
+/// Runs every model alone and then all models concurrently on the same ov::Core.
+/// Reports per-model latency, latency increase caused by co-location, aggregate throughput and
+/// resident memory of the process
+/// </summary>
+/// <param name="core">core shared by all models</param>
+/// <param name="configs">models of the benchmark</param>
+/// <param name="duration_seconds">duration of every isolated run and of the co-located run</param>
+/// <param name="statistics">statistics report to add results to, may be nullptr</param>
+void run_colocated_benchmark(ov::Core& core,
+                             const std::vector<ColocatedModelConfig>& configs,
+                             uint64_t duration_seconds,
+                             const std::shared_ptr<StatisticsReport>& statistics);
@@ -51,6 +51,13 @@ public:
         _request.start_async();
     }
 
+    // open-loop load measures latency from the scheduled arrival time of the request,
+    // so the time it waited for an idle infer request is not omitted
+    void start_async(const Time::time_point& arrivalTime) {
+        _startTime = arrivalTime;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
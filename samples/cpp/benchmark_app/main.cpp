@@ -6,7 +6,9 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -22,6 +24,7 @@
 #include "samples/slog.hpp"
 
 #include "benchmark_app.hpp"
+#include "colocated_benchmark.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
 #include "remote_tensors_filling.hpp"
@@ -41,7 +44,7 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_models_config.empty()) {
         show_usage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
@@ -81,6 +84,20 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         throw std::logic_error(pcsort_err);
     }
 
+    if (FLAGS_arrival_rate < 0 || FLAGS_latency_slo < 0) {
+        throw std::logic_error("-arrival_rate and -latency_slo options expect positive values.");
+    }
+    if (!FLAGS_arrival_trace.empty() && (FLAGS_arrival_rate > 0 || FLAGS_latency_slo > 0)) {
+        throw std::logic_error("-arrival_trace option can't be combined with -arrival_rate and -latency_slo options.");
+    }
+    if (!FLAGS_models_config.empty() && (!FLAGS_m.empty() || !FLAGS_arrival_trace.empty() || FLAGS_latency_slo > 0)) {
+        throw std::logic_error("-models_config option can't be combined with -m, -arrival_trace and -latency_slo "
+                               "options.");
+    }
+    if ((FLAGS_arrival_rate > 0 || !FLAGS_arrival_trace.empty() || FLAGS_latency_slo > 0) && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop load (-arrival_rate, -arrival_trace, -latency_slo) requires async API.");
+    }
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -331,6 +348,16 @@ int main(int argc, char* argv[]) {
         slog::info << "Device info:" << slog::endl;
         slog::info << core.get_versions(device_name) << slog::endl;
 
+        if (!FLAGS_models_config.empty()) {
+            auto models = load_colocated_models(FLAGS_models_config, FLAGS_arrival_rate);
+            uint64_t duration_seconds = FLAGS_t != 0 ? FLAGS_t : device_default_device_duration_in_seconds(device_name);
+            run_colocated_benchmark(core, models, duration_seconds, statistics);
+            if (statistics) {
+                statistics->dump();
+            }
+            return 0;
+        }
+
         // ----------------- 3. Setting device configuration
         // -----------------------------------------------------------
         next_step();
@@ -1162,20 +1189,8 @@ int main(int argc, char* argv[]) {
         inferRequestsQueue.reset_times();
 
         size_t processedFramesN = 0;
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                throw ov::Exception("No idle Infer Requests!");
-            }
 
+        auto prepare_request = [&](const InferReqWrap::Ptr& inferRequest, size_t iteration) {
             if (!inferenceOnly) {
                 auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
 
@@ -1201,16 +1216,146 @@ int main(int argc, char* argv[]) {
                     }
                 }
             }
+        };
+
+        std::vector<double> arrivalTrace;
+        if (!FLAGS_arrival_trace.empty()) {
+            arrivalTrace = load_arrival_trace(FLAGS_arrival_trace);
+        }
+        const bool openLoop = FLAGS_arrival_rate > 0 || !arrivalTrace.empty() || FLAGS_latency_slo > 0;
+
+        /** Open-loop load: requests are submitted at the arrival times of a Poisson process with the given rate
+         * (or of the arrival trace) regardless of completion of the previous requests until one of the limits
+         * (0 means no limit) is reached **/
+        auto run_open_loop = [&](double arrivalRate, uint64_t durationLimitNs, int64_t iterationsLimit) {
+            inferRequestsQueue.reset_times();
+            iteration = 0;
+            processedFramesN = 0;
+            std::mt19937 generator(42);
+            std::exponential_distribution<double> interArrivalMs(arrivalRate > 0 ? arrivalRate / 1000.0 : 1.0);
+            const auto startTime = Time::now();
+            double arrivalMs = 0;
+            while (true) {
+                if (!arrivalTrace.empty()) {
+                    if (iteration == arrivalTrace.size()) {
+                        break;
+                    }
+                    arrivalMs = arrivalTrace[iteration];
+                } else if (iteration != 0) {
+                    arrivalMs += interArrivalMs(generator);
+                }
+                if ((iterationsLimit != 0LL && iteration >= iterationsLimit) ||
+                    (durationLimitNs != 0LL && arrivalMs * 1000000.0 >= durationLimitNs)) {
+                    break;
+                }
+                const auto arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(
+                                                         std::chrono::duration<double, std::milli>(arrivalMs));
+                std::this_thread::sleep_until(arrivalTime);
+
+                auto inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    throw ov::Exception("No idle Infer Requests!");
+                }
+                prepare_request(inferRequest, iteration);
+                inferRequest->start_async(arrivalTime);
+                ++iteration;
+                processedFramesN += batchSize;
+            }
+            inferRequestsQueue.wait_all();
+        };
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
+        double sloArrivalRate = 0;
+        if (FLAGS_latency_slo > 0) {
+            // every search step is a short probe run, the found arrival rate is confirmed by a full-length run
+            static constexpr uint64_t minProbeDurationNs = 1000000000ULL;
+            static constexpr int64_t minProbeIterations = 100;
+            const uint64_t probeDurationNs =
+                duration_nanoseconds != 0LL
+                    ? std::min<uint64_t>(duration_nanoseconds,
+                                         std::max<uint64_t>(duration_nanoseconds / 10, minProbeDurationNs))
+                    : 0;
+            const int64_t probeIterations =
+                niter != 0LL ? std::min<int64_t>(niter, std::max<int64_t>(niter / 10, minProbeIterations)) : 0;
+            auto meets_slo = [&](double arrivalRate) {
+                run_open_loop(arrivalRate, probeDurationNs, probeIterations);
+                auto p99 = get_latency_percentile(inferRequestsQueue.get_latencies(), 99);
+                slog::info << "Arrival rate " << double_to_string(arrivalRate)
+                           << " requests/s: 99th percentile latency " << double_to_string(p99) << " ms" << slog::endl;
+                return p99 <= FLAGS_latency_slo;
+            };
+            // exponential probing brackets the maximal arrival rate meeting the SLO, bisection narrows the bracket
+            static constexpr size_t maxProbingSteps = 16;
+            static constexpr size_t maxBisectionSteps = 8;
+            static constexpr double searchPrecision = 0.05;
+            double lowRate = 0;
+            double highRate = 0;
+            double arrivalRate = FLAGS_arrival_rate > 0 ? FLAGS_arrival_rate : 1000.0 / std::max(duration_ms, 0.001);
+            for (size_t step = 0; step < maxProbingSteps && highRate == 0; ++step) {
+                if (meets_slo(arrivalRate)) {
+                    lowRate = arrivalRate;
+                    arrivalRate *= 2;
+                } else {
+                    highRate = arrivalRate;
+                }
+            }
+            for (size_t step = 0; highRate != 0 && step < maxBisectionSteps &&
+                                  highRate - lowRate > searchPrecision * highRate;
+                 ++step) {
+                const double middleRate = (lowRate + highRate) / 2;
+                if (meets_slo(middleRate)) {
+                    lowRate = middleRate;
+                } else {
+                    highRate = middleRate;
+                }
+            }
+            sloArrivalRate = lowRate;
+            if (lowRate == 0) {
+                slog::warn << "Latency SLO " << double_to_string(FLAGS_latency_slo)
+                           << " ms is not met at any probed arrival rate" << slog::endl;
             } else {
-                inferRequest->start_async();
+                // the reported results are the ones of the full-length run at the found arrival rate
+                run_open_loop(lowRate, duration_nanoseconds, niter);
+                auto p99 = get_latency_percentile(inferRequestsQueue.get_latencies(), 99);
+                slog::info << "Confirmation run at " << double_to_string(lowRate)
+                           << " requests/s: 99th percentile latency " << double_to_string(p99) << " ms" << slog::endl;
+                if (p99 > FLAGS_latency_slo) {
+                    slog::warn << "Latency SLO " << double_to_string(FLAGS_latency_slo)
+                               << " ms is not met by the full-length run, the probe runs may be too short "
+                                  "for the model"
+                               << slog::endl;
+                }
             }
-            ++iteration;
+            slog::info << "Maximal arrival rate meeting the latency SLO: " << double_to_string(sloArrivalRate)
+                       << " requests/s" << slog::endl;
+        } else if (openLoop) {
+            run_open_loop(FLAGS_arrival_rate, duration_nanoseconds, niter);
+        } else {
+            auto startTime = Time::now();
+            auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    throw ov::Exception("No idle Infer Requests!");
+                }
+
+                prepare_request(inferRequest, iteration);
+
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    inferRequest->start_async();
+                }
+                ++iteration;
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
+            }
         }
 
         // wait the latest inference executions
@@ -1264,6 +1409,28 @@ int main(int argc, char* argv[]) {
                     }
                 }
             }
+            if (openLoop) {
+                const auto& latencies = inferRequestsQueue.get_latencies();
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                           {StatisticsVariant("50 percentile latency (ms)",
+                                                              "latency_p50",
+                                                              get_latency_percentile(latencies, 50)),
+                                            StatisticsVariant("90 percentile latency (ms)",
+                                                              "latency_p90",
+                                                              get_latency_percentile(latencies, 90)),
+                                            StatisticsVariant("99 percentile latency (ms)",
+                                                              "latency_p99",
+                                                              get_latency_percentile(latencies, 99)),
+                                            StatisticsVariant("99.9 percentile latency (ms)",
+                                                              "latency_p99_9",
+                                                              get_latency_percentile(latencies, 99.9))});
+            }
+            if (FLAGS_latency_slo > 0) {
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                           {StatisticsVariant("max arrival rate meeting latency SLO (requests/s)",
+                                                              "slo_arrival_rate",
+                                                              sloArrivalRate)});
+            }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
         }
@@ -1342,6 +1509,19 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        if (openLoop) {
+            const auto& latencies = inferRequestsQueue.get_latencies();
+            slog::info << "Latency percentiles (from scheduled arrival):" << slog::endl;
+            slog::info << "   50:               " << double_to_string(get_latency_percentile(latencies, 50)) << " ms"
+                       << slog::endl;
+            slog::info << "   90:               " << double_to_string(get_latency_percentile(latencies, 90)) << " ms"
+                       << slog::endl;
+            slog::info << "   99:               " << double_to_string(get_latency_percentile(latencies, 99)) << " ms"
+                       << slog::endl;
+            slog::info << "   99.9:             " << double_to_string(get_latency_percentile(latencies, 99.9))
+                       << " ms" << slog::endl;
+        }
+
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
     } catch (const std::exception& ex) {
@@ -5,6 +5,8 @@
 #include <format_reader_ptr.h>
 
 #include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <map>
 #include <regex>
 #include <string>
@@ -807,6 +809,39 @@ const std::vector<std::string> supported_image_extensions = {"bmp"};
 #endif
 const std::vector<std::string> supported_binary_extensions = {"bin"};
 
+std::vector<double> load_arrival_trace(const std::string& filename) {
+    std::ifstream input(filename);
+    if (!input.is_open()) {
+        throw std::runtime_error("Can't open arrival trace file \"" + filename + "\"");
+    }
+    std::vector<double> arrivals;
+    for (double timestamp = 0; input >> timestamp;) {
+        arrivals.push_back(timestamp);
+    }
+    if (!input.eof()) {
+        throw std::runtime_error("Arrival trace file \"" + filename + "\" contains a non-numeric value");
+    }
+    if (arrivals.empty()) {
+        throw std::runtime_error("Arrival trace file \"" + filename + "\" is empty");
+    }
+    std::sort(arrivals.begin(), arrivals.end());
+    const auto first = arrivals.front();
+    for (auto& arrival : arrivals) {
+        arrival -= first;
+    }
+    return arrivals;
+}
+
+double get_latency_percentile(std::vector<double> latencies, double percentile) {
+    if (latencies.empty()) {
+        throw std::logic_error("Latency percentile can't be calculated for empty vector of latencies");
+    }
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * latencies.size()));
+    auto index = std::min(std::max<size_t>(rank, 1), latencies.size()) - 1;
+    std::nth_element(latencies.begin(), latencies.begin() + index, latencies.end());
+    return latencies[index];
+}
+
 std::string get_extension(const std::string& name) {
     auto extensionPosition = name.rfind('.', name.size());
     return extensionPosition == std::string::npos ? "" : name.substr(extensionPosition + 1, name.size() - 1);
@@ -117,6 +117,19 @@ std::vector<benchmark_app::InputsInfo> get_inputs_info(const std::string& shape_
 void dump_config(const std::string& filename, const std::map<std::string, ov::AnyMap>& config);
 void load_config(const std::string& filename, std::map<std::string, ov::AnyMap>& config);
 
+/// <summary>
+/// Reads arrival timestamps of open-loop requests: one timestamp in milliseconds per line
+/// </summary>
+/// <returns>timestamps relative to the first one, in ascending order</returns>
+std::vector<double> load_arrival_trace(const std::string& filename);
+
+/// <summary>
+/// Returns the nearest-rank percentile of the latencies
+/// </summary>
+/// <param name="latencies">non-empty vector of latencies</param>
+/// <param name="percentile">percentile in (0, 100] range, fractional values like 99.9 are allowed</param>
+double get_latency_percentile(std::vector<double> latencies, double percentile);
+
 extern const std::vector<std::string> supported_image_extensions;
 extern const std::vector<std::string> supported_binary_extensions;
 
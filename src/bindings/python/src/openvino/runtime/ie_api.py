@@ -82,11 +82,13 @@ def _(
     )
 
 
-def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
+def normalize_inputs(request: InferRequestBase, inputs: dict, shared_memory: bool = False) -> dict:
     """Helper function to prepare inputs for inference.
 
     It creates copy of Tensors or copy data to already allocated Tensors on device
     if the item is of type `np.ndarray`, `np.number`, `int`, `float` or has numpy __array__ attribute.
+    If `shared_memory` is True, `np.ndarray` items are passed as they are to be bound to the request
+    without copying.
     """
     # Create new temporary dictionary.
     # new_inputs will be used to transfer data to inference calls,
@@ -95,8 +97,11 @@ def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
     for key, value in inputs.items():
         if not isinstance(key, (str, int, ConstOutput)):
             raise TypeError(f"Incompatible key type for input: {key}")
+        # Pass numpy arrays to share their memory with the request.
+        if shared_memory and isinstance(value, np.ndarray) and value.shape:
+            new_inputs[key] = value
         # Copy numpy arrays to already allocated Tensors.
-        if isinstance(value, (np.ndarray, np.number, int, float)):
+        elif isinstance(value, (np.ndarray, np.number, int, float)):
             update_tensor(value, request, key)
         # If value is of Tensor type, put it into temporary dictionary.
         elif isinstance(value, Tensor):
@@ -110,10 +115,33 @@ def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
     return new_inputs
 
 
+def batch_item_to_dict(inputs: Any) -> dict:
+    """Helper function to convert an item of AsyncInferQueue batch to the dictionary of Tensors or numpy arrays."""
+    if inputs is None:
+        return {}
+    elif isinstance(inputs, dict):
+        items = inputs
+    elif isinstance(inputs, (list, tuple)):
+        items = {index: input for index, input in enumerate(inputs)}
+    else:
+        items = {0: inputs}
+    result: Dict[Union[str, int, ConstOutput], Union[Tensor, np.ndarray]] = {}
+    for key, value in items.items():
+        if not isinstance(key, (str, int, ConstOutput)):
+            raise TypeError(f"Incompatible key type for input: {key}")
+        if isinstance(value, (Tensor, np.ndarray)):
+            result[key] = value
+        elif isinstance(value, (np.number, int, float)) or hasattr(value, "__array__"):
+            result[key] = np.array(value)
+        else:
+            raise TypeError(f"Incompatible input data of type {type(value)} under {key} key!")
+    return result
+
+
 class InferRequest(InferRequestBase):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
-    def infer(self, inputs: Any = None) -> dict:
+    def infer(self, inputs: Any = None, shared_memory: bool = False) -> dict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of InferRequest while request is running.
@@ -137,31 +165,42 @@ class InferRequest(InferRequestBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Any, optional
+        :param shared_memory: If `True`, C contiguous numpy arrays of input element types are bound
+                              to the request without copying and must not be modified until the inference
+                              is finished. Results are numpy views of output tensors instead of copies,
+                              they are overwritten by the next inference of this InferRequest.
+        :type shared_memory: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         # If inputs are empty, pass empty dictionary.
         if inputs is None:
-            return super().infer({})
+            return super().infer({}, shared_memory)
         # If inputs are dict, normalize dictionary and call infer method.
         elif isinstance(inputs, dict):
-            return super().infer(normalize_inputs(self, inputs))
+            return super().infer(normalize_inputs(self, inputs, shared_memory), shared_memory)
         # If inputs are list or tuple, enumarate inputs and save them as dictionary.
         # It is an extension of above branch with dict inputs.
         elif isinstance(inputs, (list, tuple)):
-            return super().infer(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}))
+            return super().infer(
+                normalize_inputs(self, {index: input for index, input in enumerate(inputs)}, shared_memory),
+                shared_memory,
+            )
         # If inputs are Tensor, call infer method directly.
         elif isinstance(inputs, Tensor):
-            return super().infer(inputs)
+            return super().infer(inputs, shared_memory)
+        # Single numpy array of single input model is bound to the request as it is.
+        elif shared_memory and isinstance(inputs, np.ndarray) and inputs.shape and len(self.model_inputs) == 1:
+            return super().infer({0: inputs}, shared_memory)
         # If inputs are single numpy array or scalars, use helper function to copy them
         # directly to Tensor or create temporary Tensor to pass into the InferRequest.
         # Pass empty dictionary to infer method, inputs are already set by helper function.
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
             update_tensor(inputs, self)
-            return super().infer({})
+            return super().infer({}, shared_memory)
         elif hasattr(inputs, "__array__"):
             update_tensor(np.array(inputs, copy=True), self)
-            return super().infer({})
+            return super().infer({}, shared_memory)
         else:
             raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
@@ -169,6 +208,7 @@ class InferRequest(InferRequestBase):
         self,
         inputs: Any = None,
         userdata: Any = None,
+        shared_memory: bool = False,
     ) -> None:
         """Starts inference of specified input(s) in asynchronous mode.
 
@@ -196,15 +236,25 @@ class InferRequest(InferRequestBase):
         :type inputs: Any, optional
         :param userdata: Any data that will be passed inside the callback.
         :type userdata: Any
+        :param shared_memory: If `True`, C contiguous numpy arrays of input element types are bound
+                              to the request without copying and must not be modified until the inference
+                              is finished.
+        :type shared_memory: bool, optional
         """
         if inputs is None:
             super().start_async({}, userdata)
         elif isinstance(inputs, dict):
-            super().start_async(normalize_inputs(self, inputs), userdata)
+            super().start_async(normalize_inputs(self, inputs, shared_memory), userdata, shared_memory)
         elif isinstance(inputs, (list, tuple)):
-            super().start_async(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}), userdata)
+            super().start_async(
+                normalize_inputs(self, {index: input for index, input in enumerate(inputs)}, shared_memory),
+                userdata,
+                shared_memory,
+            )
         elif isinstance(inputs, Tensor):
             super().start_async(inputs, userdata)
+        elif shared_memory and isinstance(inputs, np.ndarray) and inputs.shape and len(self.model_inputs) == 1:
+            super().start_async({0: inputs}, userdata, shared_memory)
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
             update_tensor(inputs, self)
             return super().start_async({}, userdata)
@@ -303,6 +353,7 @@ class AsyncInferQueue(AsyncInferQueueBase):
         self,
         inputs: Any = None,
         userdata: Any = None,
+        shared_memory: bool = False,
     ) -> None:
         """Run asynchronous inference using the next available InferRequest from the pool.
 
@@ -326,24 +377,33 @@ class AsyncInferQueue(AsyncInferQueueBase):
         :type inputs: Any, optional
         :param userdata: Any data that will be passed to a callback.
         :type userdata: Any, optional
+        :param shared_memory: If `True`, C contiguous numpy arrays of input element types are bound
+                              to the InferRequest without copying and must not be modified until the inference
+                              is finished.
+        :type shared_memory: bool, optional
         """
         if inputs is None:
             super().start_async({}, userdata)
         elif isinstance(inputs, dict):
             super().start_async(
-                normalize_inputs(self[self.get_idle_request_id()], inputs),
+                normalize_inputs(self[self.get_idle_request_id()], inputs, shared_memory),
                 userdata,
+                shared_memory,
             )
         elif isinstance(inputs, (list, tuple)):
             super().start_async(
                 normalize_inputs(
                     self[self.get_idle_request_id()],
                     {index: input for index, input in enumerate(inputs)},
+                    shared_memory,
                 ),
                 userdata,
+                shared_memory,
             )
         elif isinstance(inputs, Tensor):
             super().start_async(inputs, userdata)
+        elif shared_memory and isinstance(inputs, np.ndarray) and inputs.shape and len(self[0].model_inputs) == 1:
+            super().start_async({0: inputs}, userdata, shared_memory)
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
             update_tensor(inputs, self[self.get_idle_request_id()])
             super().start_async({}, userdata)
@@ -353,6 +413,32 @@ class AsyncInferQueue(AsyncInferQueueBase):
         else:
             raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
+    def start_async_batch(
+        self,
+        inputs: Iterable[Any],
+        userdata: Optional[Iterable[Any]] = None,
+        shared_memory: bool = False,
+    ) -> None:
+        """Run asynchronous inference of every item of the batch using next available InferRequests.
+
+        Unlike calling `start_async` for every item, GIL is released once for the whole batch.
+        Every item accepts the same types of inputs as `start_async`.
+
+        :param inputs: Items of the batch, data to be set on input tensors of InferRequests.
+        :type inputs: Iterable[Any]
+        :param userdata: Data that will be passed to a callback for every item of the batch.
+        :type userdata: Iterable[Any], optional
+        :param shared_memory: If `True`, C contiguous numpy arrays of input element types are bound
+                              to InferRequests without copying and must not be modified until the inference
+                              is finished. Otherwise data of arrays is copied.
+        :type shared_memory: bool, optional
+        """
+        super().start_async_batch(
+            [batch_item_to_dict(item) for item in inputs],
+            [] if userdata is None else list(userdata),
+            shared_memory,
+        )
+
 
 class Core(CoreBase):
     """Core class represents OpenVINO runtime Core entity.
@@ -9,9 +9,11 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <map>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -84,6 +86,60 @@ public:
             throw m_errors.front();
     }
 
+    // Starts inference of every item of the batch, GIL is released once for the whole batch.
+    // Every item is a dict of inputs with the same keys and values as in start_async.
+    void start_async_batch(const py::list& inputs, const py::list& userdata, bool shared_memory) {
+        if (!userdata.empty() && userdata.size() != inputs.size()) {
+            throw py::value_error("Number of userdata items must be equal to number of inputs items!");
+        }
+
+        // Python objects are converted while GIL is held
+        struct Job {
+            std::vector<std::pair<ov::Output<const ov::Node>, ov::Tensor>> tensors;
+            std::map<ov::Output<const ov::Node>, py::object> shared_inputs;
+            py::object userdata;
+        };
+        std::vector<Job> jobs(inputs.size());
+        for (size_t i = 0; i < jobs.size(); i++) {
+            for (auto&& input : inputs[i].cast<py::dict>()) {
+                // all requests of the queue have the same ports
+                auto port = m_requests.front().get_port(input.first);
+                auto& shared_array = jobs[i].shared_inputs[port];
+                auto tensor = Common::cast_to_tensor(input.second, port, shared_memory, shared_array);
+                jobs[i].tensors.emplace_back(port, tensor);
+            }
+            jobs[i].userdata = userdata.empty() ? py::none() : py::reinterpret_borrow<py::object>(userdata[i]);
+        }
+
+        {
+            py::gil_scoped_release release;
+            for (auto&& job : jobs) {
+                size_t handle = pop_idle_handle();
+                auto& request = m_requests[handle];
+                // Swapping doesn't change reference counters, so it's safe without GIL.
+                // Previous userdata and arrays are released with the jobs when GIL is acquired back
+                std::swap(m_user_ids[handle], job.userdata);
+                for (auto&& shared_input : job.shared_inputs) {
+                    std::swap(request.m_shared_inputs[shared_input.first], shared_input.second);
+                }
+                try {
+                    for (auto&& tensor : job.tensors) {
+                        request.m_request.set_tensor(tensor.first, tensor.second);
+                    }
+                } catch (...) {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_idle_handles.push(handle);
+                    }
+                    m_cv.notify_one();
+                    throw;
+                }
+                *request.m_start_time = Time::now();
+                request.m_request.start_async();
+            }
+        }
+    }
+
     void set_default_callbacks() {
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             // auto end_time = m_requests[handle].m_end_time; // TODO: pass it bellow? like in InferRequestWrapper
@@ -151,6 +207,22 @@ public:
         }
     }
 
+    // Waits for an idle request and takes it from the queue, must be called with released GIL
+    size_t pop_idle_handle() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] {
+            return !(m_idle_handles.empty());
+        });
+        if (m_errors.size() > 0)
+            throw m_errors.front();
+        size_t idle_handle = m_idle_handles.front();
+        m_idle_handles.pop();
+        lock.unlock();
+        // wait for request to make sure it returned from callback
+        m_requests[idle_handle].m_request.wait();
+        return idle_handle;
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -229,7 +301,7 @@ void regclass_AsyncInferQueue(py::module m) {
     // and values are always of type: ov::Tensor.
     cls.def(
         "start_async",
-        [](AsyncInferQueue& self, const py::dict& inputs, py::object userdata) {
+        [](AsyncInferQueue& self, const py::dict& inputs, py::object userdata, bool shared_memory) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
             auto handle = self.get_idle_request_id();
@@ -240,7 +312,7 @@ void regclass_AsyncInferQueue(py::module m) {
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
-            Common::set_request_tensors(self.m_requests[handle].m_request, inputs);
+            self.m_requests[handle].set_inputs(inputs, shared_memory);
             // Now GIL can be released - we are NOT working with Python objects in this block
             {
                 py::gil_scoped_release release;
@@ -251,6 +323,7 @@ void regclass_AsyncInferQueue(py::module m) {
         },
         py::arg("inputs"),
         py::arg("userdata"),
+        py::arg("shared_memory") = false,
         R"(
             Run asynchronous inference using the next available InferRequest.
 
@@ -259,13 +332,37 @@ void regclass_AsyncInferQueue(py::module m) {
 
             :param inputs: Data to set on input tensors of next available InferRequest from
             AsyncInferQueue's pool.
-            :type inputs: dict[Union[int, str, openvino.runtime.ConstOutput] : openvino.runtime.Tensor]
+            :type inputs: dict[Union[int, str, openvino.runtime.ConstOutput] : Union[openvino.runtime.Tensor, numpy.array]]
             :param userdata: Any data that will be passed to a callback
+            :param shared_memory: If `True`, memory of numpy arrays is shared with the input tensors
+                                  until the next inference of the InferRequest. Otherwise arrays are copied.
+            :type shared_memory: bool
             :rtype: None
 
             GIL is released while waiting for the next available InferRequest.
         )");
 
+    cls.def("start_async_batch",
+            &AsyncInferQueue::start_async_batch,
+            py::arg("inputs"),
+            py::arg("userdata"),
+            py::arg("shared_memory") = false,
+            R"(
+            Run asynchronous inference of every item of the batch using next available InferRequests.
+
+            GIL is released once for the whole batch while waiting for available InferRequests
+            and starting them.
+
+            :param inputs: Items of the batch, each is a dict of data to set on input tensors.
+            :type inputs: List[Dict[Union[int, str, openvino.runtime.ConstOutput], Union[openvino.runtime.Tensor, numpy.array]]]
+            :param userdata: Data passed to a callback for every item or an empty list.
+            :type userdata: List[Any]
+            :param shared_memory: If `True`, memory of numpy arrays is shared with the input tensors
+                                  until the next inference of the InferRequest. Otherwise arrays are copied.
+            :type shared_memory: bool
+            :rtype: None
+        )");
+
     cls.def("is_ready",
             &AsyncInferQueue::_is_ready,
             R"(
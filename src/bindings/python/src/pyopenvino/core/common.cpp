@@ -165,10 +165,63 @@ py::array as_contiguous(py::array& array, ov::element::Type type) {
     }
 }
 
+// Returns C contiguous array with dtype matching the element type, the array itself if it is already compatible,
+// so its memory can be bound to a tensor without copying. Numpy has no sub-byte types, arrays of packed u1, u4
+// and i4 data are always copied.
+py::array as_shareable(py::array& array, const ov::element::Type& type) {
+    const auto& dtype = Common::ov_type_to_dtype().at(type);
+    if (type.bitwidth() < 8) {
+        return py::module::import("numpy").attr("array")(array, dtype, py::arg("copy") = true).cast<py::array>();
+    }
+    bool is_contiguous = C_CONTIGUOUS == (array.flags() & C_CONTIGUOUS);
+    if (is_contiguous && py::str(array.dtype()).cast<std::string>() == py::str(dtype).cast<std::string>()) {
+        return array;
+    }
+    return py::module::import("numpy").attr("ascontiguousarray")(array, dtype).cast<py::array>();
+}
+
 const ov::Tensor& cast_to_tensor(const py::handle& tensor) {
     return tensor.cast<const ov::Tensor&>();
 }
 
+ov::Tensor cast_to_tensor(const py::handle& value,
+                          const ov::Output<const ov::Node>& port,
+                          bool shared_memory,
+                          py::object& shared_array) {
+    if (py::isinstance<ov::Tensor>(value)) {
+        return Common::cast_to_tensor(value);
+    }
+    if (py::isinstance<py::array>(value)) {
+        const auto& type = port.get_element_type();
+        auto array = value.cast<py::array>();
+        array = Common::as_shareable(array, type);
+        if (type.bitwidth() < 8) {
+            // Packed data doesn't carry the shape, it is taken from the port
+            if (port.get_partial_shape().is_dynamic()) {
+                throw ov::Exception("Data of " + type.get_type_name() +
+                                    " element type must be passed as Tensor for input with dynamic shape!");
+            }
+            auto tensor = ov::Tensor(type, port.get_shape());
+            if (static_cast<size_t>(array.nbytes()) != tensor.get_byte_size()) {
+                throw ov::Exception("Size of array with packed " + type.get_type_name() +
+                                    " data doesn't match the input shape!");
+            }
+            std::memcpy(tensor.data(), array.data(), tensor.get_byte_size());
+            return tensor;
+        }
+        std::vector<size_t> shape(array.shape(), array.shape() + array.ndim());
+        if (!shared_memory) {
+            auto tensor = ov::Tensor(type, shape);
+            std::memcpy(tensor.data(), array.data(), tensor.get_byte_size());
+            return tensor;
+        }
+        // Tensor doesn't own the memory of the array, so the array is kept by the caller
+        shared_array = array;
+        return ov::Tensor(type, shape, const_cast<void*>(array.data()));
+    }
+    throw py::type_error("Incompatible input data of type " + std::string(py::str(value.get_type())) + "!");
+}
+
 const Containers::TensorNameMap cast_to_tensor_name_map(const py::dict& inputs) {
     Containers::TensorNameMap result_map;
     for (auto&& input : inputs) {
@@ -243,10 +296,21 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request) {
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool shared_memory) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::Tensor t{request.get_tensor(out)};
+        if (shared_memory && t.get_element_type().bitwidth() >= 8) {
+            // The view holds the tensor, its data is overwritten by the next inference of the request
+            auto dtype = Common::ov_type_to_dtype().at(t.get_element_type());
+            auto shape = t.get_shape();
+            auto strides = t.get_strides();
+            auto data = t.data();
+            res[py::cast(out)] = py::array(dtype, shape, strides, data, py::cast(std::move(t)));
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
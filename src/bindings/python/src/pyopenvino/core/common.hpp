@@ -36,8 +36,15 @@ ov::PartialShape partial_shape_from_list(const py::list& shape);
 
 py::array as_contiguous(py::array& array, ov::element::Type type);
 
+py::array as_shareable(py::array& array, const ov::element::Type& type);
+
 const ov::Tensor& cast_to_tensor(const py::handle& tensor);
 
+ov::Tensor cast_to_tensor(const py::handle& value,
+                          const ov::Output<const ov::Node>& port,
+                          bool shared_memory,
+                          py::object& shared_array);
+
 const Containers::TensorNameMap cast_to_tensor_name_map(const py::dict& inputs);
 
 const Containers::TensorIndexMap cast_to_tensor_index_map(const py::dict& inputs);
@@ -46,7 +53,9 @@ void set_request_tensors(ov::InferRequest& request, const py::dict& inputs);
 
 uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual);
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request);
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool shared_memory = false);
 
 ov::pass::Serialize::Version convert_to_version(const std::string& version);
 
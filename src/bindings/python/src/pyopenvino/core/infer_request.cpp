@@ -8,6 +8,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
 
+#include <functional>
 #include <string>
 
 #include "pyopenvino/core/common.hpp"
@@ -18,14 +19,44 @@ PYBIND11_MAKE_OPAQUE(Containers::TensorNameMap);
 
 namespace py = pybind11;
 
-inline py::dict run_sync_infer(InferRequestWrapper& self) {
+ov::Output<const ov::Node> InferRequestWrapper::get_port(const py::handle& key) const {
+    if (py::isinstance<ov::Output<const ov::Node>>(key)) {
+        return key.cast<ov::Output<const ov::Node>>();
+    } else if (py::isinstance<py::int_>(key)) {
+        return m_inputs.at(key.cast<size_t>());
+    } else if (py::isinstance<py::str>(key)) {
+        auto name = key.cast<std::string>();
+        for (const auto& ports : {std::cref(m_inputs), std::cref(m_outputs)}) {
+            for (const auto& port : ports.get()) {
+                if (port.get_names().count(name)) {
+                    return port;
+                }
+            }
+        }
+        throw ov::Exception("Port for tensor name " + name + " was not found.");
+    }
+    throw py::type_error("Incompatible key type for tensor named: " + std::string(py::str(key)));
+}
+
+void InferRequestWrapper::set_inputs(const py::dict& inputs, bool shared_memory) {
+    for (auto&& input : inputs) {
+        auto port = get_port(input.first);
+        py::object shared_array;
+        auto tensor = Common::cast_to_tensor(input.second, port, shared_memory, shared_array);
+        m_request.set_tensor(port, tensor);
+        // Array previously bound to the port is released
+        m_shared_inputs[port] = shared_array;
+    }
+}
+
+inline py::dict run_sync_infer(InferRequestWrapper& self, bool shared_memory) {
     {
         py::gil_scoped_release release;
         *self.m_start_time = Time::now();
         self.m_request.infer();
         *self.m_end_time = Time::now();
     }
-    return Common::outputs_to_dict(self.m_outputs, self.m_request);
+    return Common::outputs_to_dict(self.m_outputs, self.m_request, shared_memory);
 }
 
 void regclass_InferRequest(py::module m) {
@@ -42,14 +73,14 @@ void regclass_InferRequest(py::module m) {
     cls.def(
         "set_tensors",
         [](InferRequestWrapper& self, const py::dict& inputs) {
-            Common::set_request_tensors(self.m_request, inputs);
+            self.set_inputs(inputs);
         },
         py::arg("inputs"),
         R"(
             Set tensors using given keys.
 
-            :param inputs: Data to set on tensors.
-            :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], openvino.runtime.Tensor]
+            :param inputs: Data to set on tensors, data of numpy arrays is copied.
+            :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], Union[openvino.runtime.Tensor, numpy.array]]
         )");
 
     cls.def(
@@ -171,11 +202,12 @@ void regclass_InferRequest(py::module m) {
     // Overload for single input, it will throw error if a model has more than one input.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const ov::Tensor& inputs) {
+        [](InferRequestWrapper& self, const ov::Tensor& inputs, bool shared_memory) {
             self.m_request.set_input_tensor(inputs);
-            return run_sync_infer(self);
+            return run_sync_infer(self, shared_memory);
         },
         py::arg("inputs"),
+        py::arg("shared_memory") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -185,6 +217,9 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on single input tensor.
             :type inputs: openvino.runtime.Tensor
+            :param shared_memory: If `True`, results are numpy views of output tensors instead of copies.
+                                  Views are overwritten by the next inference of this InferRequest.
+            :type shared_memory: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -197,13 +232,14 @@ void regclass_InferRequest(py::module m) {
     // and values are always of type: ov::Tensor.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool shared_memory) {
             // Update inputs if there are any
-            Common::set_request_tensors(self.m_request, inputs);
+            self.set_inputs(inputs, shared_memory);
             // Call Infer function
-            return run_sync_infer(self);
+            return run_sync_infer(self, shared_memory);
         },
         py::arg("inputs"),
+        py::arg("shared_memory") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -212,7 +248,12 @@ void regclass_InferRequest(py::module m) {
             GIL is released while running the inference.
 
             :param inputs: Data to set on input tensors.
-            :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], openvino.runtime.Tensor]
+            :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], Union[openvino.runtime.Tensor, numpy.array]]
+            :param shared_memory: If `True`, memory of C contiguous numpy arrays matching input element types
+                                  is shared with the input tensors and results are numpy views of output tensors,
+                                  which are overwritten by the next inference of this InferRequest.
+                                  Otherwise arrays are copied.
+            :type shared_memory: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -259,9 +300,9 @@ void regclass_InferRequest(py::module m) {
     // and values are always of type: ov::Tensor.
     cls.def(
         "start_async",
-        [](InferRequestWrapper& self, const py::dict& inputs, py::object& userdata) {
+        [](InferRequestWrapper& self, const py::dict& inputs, py::object& userdata, bool shared_memory) {
             // Update inputs if there are any
-            Common::set_request_tensors(self.m_request, inputs);
+            self.set_inputs(inputs, shared_memory);
             if (!userdata.is(py::none())) {
                 if (self.m_user_callback_defined) {
                     self.m_userdata = userdata;
@@ -275,6 +316,7 @@ void regclass_InferRequest(py::module m) {
         },
         py::arg("inputs"),
         py::arg("userdata"),
+        py::arg("shared_memory") = false,
         R"(
             Starts inference of specified input(s) in asynchronous mode.
             Returns immediately. Inference starts also immediately.
@@ -285,9 +327,12 @@ void regclass_InferRequest(py::module m) {
             running will lead to throwing exceptions.
 
             :param inputs: Data to set on input tensors.
-            :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], openvino.runtime.Tensor]
+            :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], Union[openvino.runtime.Tensor, numpy.array]]
             :param userdata: Any data that will be passed inside callback call.
             :type userdata: Any
+            :param shared_memory: If `True`, memory of numpy arrays is shared with the input tensors
+                                  until the next inference of the InferRequest. Otherwise arrays are copied.
+            :type shared_memory: bool
         )");
 
     cls.def(
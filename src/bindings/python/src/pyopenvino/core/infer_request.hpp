@@ -5,6 +5,7 @@
 #pragma once
 
 #include <chrono>
+#include <map>
 
 #include <pybind11/pybind11.h>
 
@@ -69,6 +70,13 @@ public:
         return get_tensors_from(m_outputs);
     }
 
+    // Returns port of the model by index of input, tensor name or port itself
+    ov::Output<const ov::Node> get_port(const py::handle& key) const;
+
+    // Sets tensors or numpy arrays on the request. Arrays are copied unless shared_memory is set, then memory of
+    // arrays is shared with the request if they are C contiguous and match element types of the ports
+    void set_inputs(const py::dict& inputs, bool shared_memory = false);
+
     double get_latency() {
         auto execTime = std::chrono::duration_cast<ns>(*m_end_time - *m_start_time);
         return static_cast<double>(execTime.count()) * 0.000001;
@@ -83,6 +91,8 @@ public:
     bool m_user_callback_defined = false;
     // Data that is passed by user from Python->C++
     py::object m_userdata;
+    // Numpy arrays which memory is bound to tensors of the request, kept alive until they are replaced
+    std::map<ov::Output<const ov::Node>, py::object> m_shared_inputs;
     // Times of inference's start and finish
     std::shared_ptr<Time::time_point> m_start_time; // proposal: change to unique_ptr
     std::shared_ptr<Time::time_point> m_end_time;
@@ -973,6 +973,89 @@ def test_array_like_input_async_infer_queue(device):
         assert np.array_equal(infer_queue_list[i].get_output_tensor().data, np.abs(input_data))
 
 
+def test_infer_shared_memory(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    results = request.infer({0: arr_1, 1: arr_2}, shared_memory=True)
+    assert np.shares_memory(request.get_input_tensor(0).data, arr_1)
+    assert np.shares_memory(request.get_input_tensor(1).data, arr_2)
+    output = request.get_output_tensor()
+    assert np.shares_memory(results[request.model_outputs[0]], output.data)
+    assert np.array_equal(results[request.model_outputs[0]], arr_1 + arr_2)
+
+    # Incompatible arrays are converted, so the memory is not shared
+    arr_3 = np.array([[1, 1], [1, 1]], dtype=np.int32)
+    results = request.infer({0: arr_1, 1: arr_3}, shared_memory=True)
+    assert not np.shares_memory(request.get_input_tensor(1).data, arr_3)
+    assert np.array_equal(results[request.model_outputs[0]], arr_1 + arr_3)
+
+    results = request.infer({0: arr_1, 1: arr_2})
+    assert not np.shares_memory(results[request.model_outputs[0]], request.get_output_tensor().data)
+
+
+def test_start_async_shared_memory(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    inputs = {0: arr_1.copy(), 1: arr_2.copy()}
+    request.start_async(inputs, shared_memory=True)
+    request.wait()
+    assert np.shares_memory(request.get_input_tensor(0).data, inputs[0])
+    assert np.array_equal(request.get_output_tensor().data, arr_1 + arr_2)
+
+    request.start_async({0: arr_1, 1: arr_2})
+    request.wait()
+    assert not np.shares_memory(request.get_input_tensor(0).data, arr_1)
+    assert np.array_equal(request.get_output_tensor().data, arr_1 + arr_2)
+
+
+def test_set_tensors_copies_arrays(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    request.set_tensors({0: arr_1, 1: arr_2})
+    assert not np.shares_memory(request.get_input_tensor(0).data, arr_1)
+    assert not np.shares_memory(request.get_input_tensor(1).data, arr_2)
+    request.infer()
+    assert np.array_equal(request.get_output_tensor().data, arr_1 + arr_2)
+
+
+@pytest.mark.parametrize("shared_memory", [True, False])
+def test_infer_queue_start_async_shared_memory(device, shared_memory):
+    input_shape = [2, 2]
+    param = ops.parameter(input_shape, np.float32)
+    model = Model(ops.abs(param), [param])
+    core = Core()
+    infer_queue = AsyncInferQueue(core.compile_model(model, device), 1)
+    array = np.full(input_shape, -1, dtype=np.float32)
+
+    infer_queue.start_async({0: array}, shared_memory=shared_memory)
+    infer_queue.wait_all()
+    assert np.shares_memory(infer_queue[0].get_input_tensor().data, array) == shared_memory
+    assert np.array_equal(infer_queue[0].get_output_tensor().data, np.abs(array))
+
+
+@pytest.mark.parametrize("shared_memory", [True, False])
+def test_infer_queue_start_async_batch(device, shared_memory):
+    jobs = 8
+    num_request = 4
+    input_shape = [2, 2]
+    param = ops.parameter(input_shape, np.float32)
+    model = Model(ops.abs(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        results[job_id] = request.get_output_tensor().data.copy()
+
+    infer_queue.set_callback(callback)
+    inputs = [np.full(input_shape, -i, dtype=np.float32) for i in range(jobs)]
+    infer_queue.start_async_batch([{0: array} for array in inputs], range(jobs), shared_memory=shared_memory)
+    infer_queue.wait_all()
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.abs(inputs[i]))
+
+
 def test_convert_infer_request(device):
     request, arr_1, arr_2 = create_simple_request_and_inputs(device)
     inputs = [arr_1, arr_2]
@@ -68,7 +68,17 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
         _preproc.reset(new PreprocEngine);
     }
 
-    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    // mean and scale are folded into preprocessing only for BF16 and I8 network inputs,
+    // a plugin normalizes FP32 inputs by itself
+    PreprocEngine::Normalization normalization;
+    const auto outPrecision = preprocessedBlob->getTensorDesc().getPrecision();
+    if (info.getMeanVariant() == MEAN_VALUE && (outPrecision == Precision::I8 || outPrecision == Precision::BF16)) {
+        for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+            normalization.emplace_back(info[c]->meanValue, 1.f / info[c]->stdScale);
+        }
+    }
+
+    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize, normalization);
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
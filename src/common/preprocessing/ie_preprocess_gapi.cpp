@@ -83,6 +83,9 @@ inline int get_cv_depth(const TensorDesc &ie_desc) {
     case Precision::U16:  return CV_16U;
     case Precision::I16:  return CV_16S;
     case Precision::FP16: return CV_16F;
+    case Precision::I8:   return CV_8S;
+    // bfloat16 values are stored in 16-bit unsigned planes and written by ConvertNormalized only
+    case Precision::BF16: return CV_16U;
 
     default: IE_THROW() << "Unsupported data type";
     }
@@ -557,7 +560,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const PreprocEngine::Normalization& normalization) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -674,7 +678,20 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
+    if (!normalization.empty()) {
+        // BF16/I8 network input: fold mean and scale into the only conversion of the plane
+        const int planes_prec = need_tmp_prec_conv ? tmp_prec : in_desc.prec;
+        for (size_t c = 0; c < outputs.size(); ++c) {
+            auto plane = outputs[c];
+            if (planes_prec != CV_8U && planes_prec != CV_32F) {
+                plane = gapi::ConvertDepth::on(plane, tmp_prec);
+            }
+            outputs[c] = gapi::ConvertNormalized::on(plane,
+                                                     normalization[c].first,
+                                                     normalization[c].second,
+                                                     out_desc.prec);
+        }
+    } else if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
         auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
             std::vector<cv::GMat> dst_gmats;
             std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
@@ -712,13 +729,15 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    Normalization last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = *_lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    Normalization new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -734,7 +753,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -907,7 +926,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const Normalization& normalization) {
 
     validateBlob(inBlob);
 
@@ -941,6 +960,25 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                             << batch_size << " > " << out_desc.d.N << " (expected by network)";
     }
 
+    const auto in_prec = in_desc_ie.getPrecision();
+    if (in_prec == Precision::I8 || in_prec == Precision::BF16) {
+        IE_THROW() << "Input blob precision " << in_prec << " is supported only as network's input precision";
+    }
+
+    // BF16 and I8 network inputs are produced by ConvertNormalized, identity if no mean and scale are given
+    Normalization out_norm;
+    const auto out_prec = out_desc_ie.getPrecision();
+    if (out_prec == Precision::I8 || out_prec == Precision::BF16) {
+        if (normalization.empty()) {
+            out_norm.assign(out_desc.d.C, {0.f, 1.f});
+        } else if (normalization.size() == static_cast<size_t>(out_desc.d.C)) {
+            out_norm = normalization;
+        } else {
+            IE_THROW() << "Number of mean and scale values " << normalization.size()
+                       << " != network's expected number of channels " << out_desc.d.C;
+        }
+    }
+
     CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
                                             in_layout,
                                             in_desc_ie.getDims(),
@@ -949,7 +987,8 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  out_norm };
 
     if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
         //if requested output parameters match input blob no need to do anything
@@ -974,7 +1013,8 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            out_layout,
                            algorithm,
                            in_fmt,
-                           out_fmt));
+                           out_fmt,
+                           out_norm));
         }
     }
 
@@ -986,7 +1026,8 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const Normalization& normalization) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
 
     // output is always a memory blob
@@ -1007,7 +1048,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1016,7 +1057,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
     IE_SUPPRESS_DEPRECATED_END
 
@@ -1027,7 +1068,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization);
     }
 }
 }  // namespace InferenceEngine
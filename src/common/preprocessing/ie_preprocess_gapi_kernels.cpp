@@ -31,6 +31,7 @@
 #include <opencv2/gapi/gcompoundkernel.hpp>
 
 #include <algorithm>
+#include <cstring>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -2006,6 +2007,62 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+namespace {
+
+inline uint16_t float_to_bf16(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+        return static_cast<uint16_t>((bits >> 16) | 0x40);  // keep NaN quiet
+    }
+    bits += 0x7FFF + ((bits >> 16) & 1);  // round to nearest even
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+template <typename src_t>
+void convert_normalized_i8(const uint8_t* src, uint8_t* dst, const int width, float mean, float scale) {
+    const auto *in  = reinterpret_cast<const src_t *>(src);
+          auto *out = reinterpret_cast<int8_t *>(dst);
+
+    for (int i = 0; i < width; i++) {
+        const float value = (static_cast<float>(in[i]) - mean) * scale;
+        out[i] = static_cast<int8_t>(std::lrint((std::min)(127.f, (std::max)(-128.f, value))));
+    }
+}
+
+template <typename src_t>
+void convert_normalized_bf16(const uint8_t* src, uint8_t* dst, const int width, float mean, float scale) {
+    const auto *in  = reinterpret_cast<const src_t *>(src);
+          auto *out = reinterpret_cast<uint16_t *>(dst);
+
+    for (int i = 0; i < width; i++) {
+        out[i] = float_to_bf16((static_cast<float>(in[i]) - mean) * scale);
+    }
+}
+
+}  // namespace
+
+GAPI_FLUID_KERNEL(FConvertNormalized, ConvertNormalized, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, double mean, double scale, int depth,
+                    cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F);
+        GAPI_Assert(dst.meta().depth == CV_8S || dst.meta().depth == CV_16U);
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        using p_f = void (*)(const uint8_t* src, uint8_t* dst, const int width, float mean, float scale);
+        const bool u8_input = src.meta().depth == CV_8U;
+        const p_f func = (depth == CV_8S) ?
+            (u8_input ? convert_normalized_i8<uint8_t> : convert_normalized_i8<float>) :
+            (u8_input ? convert_normalized_bf16<uint8_t> : convert_normalized_bf16<float>);
+
+        func(src.InLineB(0), dst.OutLineB(), dst.length(), static_cast<float>(mean), static_cast<float>(scale));
+    }
+};
+
 namespace {
     template <typename src_t, typename dst_t>
     void sub(const uint8_t* src, uint8_t* dst, const int width, double c) {
@@ -2070,6 +2127,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         cv::gapi::kernels
         < FScalePlane
         , FConvertDepth
+        , FConvertNormalized
         , FSubC
         , FDivC
         >());
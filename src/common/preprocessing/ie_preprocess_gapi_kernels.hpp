@@ -198,6 +198,17 @@ namespace gapi {
         }
     };
 
+    // Computes (in - mean) * scale and stores it as saturated int8 (CV_8S) or as bfloat16 bit patterns (CV_16U),
+    // so the model input is written directly without an intermediate FP32 plane
+    G_TYPED_KERNEL(ConvertNormalized, <cv::GMat(cv::GMat, double, double, int)>, "com.intel.ie.ConvertNormalized") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, double /*mean*/, double /*scale*/, int depth) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(depth == CV_8S || depth == CV_16U);
+
+            return in.withDepth(depth);
+        }
+    };
+
     G_TYPED_KERNEL(GSubC, <cv::GMat(cv::GMat, cv::GScalar, int)>, "com.intel.ie.math.subC") {
         static cv::GMatDesc outMeta(cv::GMatDesc a, cv::GScalarDesc, int ddepth) {
             return a.withDepth(ddepth);
@@ -9,6 +9,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "openvino/core/parallel.hpp"
 
 using namespace ngraph;
 
@@ -41,6 +42,8 @@ void reshape_in1(const char* in,
     }
 }
 
+// Transpose kernels below split the work over the outermost output dimension: every outer index produces
+// a contiguous block of the output, so the blocks can be filled independently.
 void reshape_in2(const char* in,
                  char* out,
                  const Shape& in_shape,
@@ -48,23 +51,22 @@ void reshape_in2(const char* in,
                  const Shape& out_shape,
                  size_t elem_size) {
     size_t size[2];
-    size_t in_index[2];
-    size_t* map_index[2];
+    size_t in_strides[2];
     for (size_t i = 0; i < 2; i++) {
         size[i] = in_shape[in_axis_order[i]];
-        map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
-            // clang-format off
-                memcpy(out,
-                       in + (*map_index[0] * in_shape[1] +
-                             *map_index[1]) * elem_size,
-                       elem_size);
-                out += elem_size;
-            // clang-format on
-        }
+    const size_t strides[2] = {in_shape[1], 1};
+    for (size_t i = 0; i < 2; i++) {
+        in_strides[i] = strides[in_axis_order[i]];
     }
+    const size_t out_block = size[1] * elem_size;
+    ov::parallel_for(size[0], [&](size_t i0) {
+        char* dst = out + i0 * out_block;
+        for (size_t i1 = 0; i1 < size[1]; ++i1) {
+            memcpy(dst, in + (i0 * in_strides[0] + i1 * in_strides[1]) * elem_size, elem_size);
+            dst += elem_size;
+        }
+    });
 }
 
 void reshape_in3(const char* in,
@@ -74,26 +76,34 @@ void reshape_in3(const char* in,
                  const Shape& out_shape,
                  size_t elem_size) {
     size_t size[3];
-    size_t in_index[3];
-    size_t* map_index[3];
+    size_t in_strides[3];
     for (size_t i = 0; i < 3; i++) {
         size[i] = in_shape[in_axis_order[i]];
-        map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
-            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
+    // clang-format off
+    const size_t strides[3] = {in_shape[1] * in_shape[2],
+                               in_shape[2],
+                               1};
+    // clang-format on
+    for (size_t i = 0; i < 3; i++) {
+        in_strides[i] = strides[in_axis_order[i]];
+    }
+    const size_t out_block = size[1] * size[2] * elem_size;
+    ov::parallel_for(size[0], [&](size_t i0) {
+        char* dst = out + i0 * out_block;
+        for (size_t i1 = 0; i1 < size[1]; ++i1) {
+            for (size_t i2 = 0; i2 < size[2]; ++i2) {
                 // clang-format off
-                    memcpy(out,
-                           in + (*map_index[0] * in_shape[1] * in_shape[2] +
-                                 *map_index[1] * in_shape[2] +
-                                 *map_index[2]) * elem_size,
-                           elem_size);
-                    out += elem_size;
+                memcpy(dst,
+                       in + (i0 * in_strides[0] +
+                             i1 * in_strides[1] +
+                             i2 * in_strides[2]) * elem_size,
+                       elem_size);
+                dst += elem_size;
                 // clang-format on
             }
         }
-    }
+    });
 }
 
 void reshape_in4(const char* in,
@@ -103,29 +113,38 @@ void reshape_in4(const char* in,
                  const Shape& out_shape,
                  size_t elem_size) {
     size_t size[4];
-    size_t in_index[4];
-    size_t* map_index[4];
+    size_t in_strides[4];
     for (size_t i = 0; i < 4; i++) {
         size[i] = in_shape[in_axis_order[i]];
-        map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
-        for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
-            for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
-                for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
+    // clang-format off
+    const size_t strides[4] = {in_shape[1] * in_shape[2] * in_shape[3],
+                               in_shape[2] * in_shape[3],
+                               in_shape[3],
+                               1};
+    // clang-format on
+    for (size_t i = 0; i < 4; i++) {
+        in_strides[i] = strides[in_axis_order[i]];
+    }
+    const size_t out_block = size[1] * size[2] * size[3] * elem_size;
+    ov::parallel_for(size[0], [&](size_t i0) {
+        char* dst = out + i0 * out_block;
+        for (size_t i1 = 0; i1 < size[1]; ++i1) {
+            for (size_t i2 = 0; i2 < size[2]; ++i2) {
+                for (size_t i3 = 0; i3 < size[3]; ++i3) {
                     // clang-format off
-                        memcpy(out,
-                               in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[2] * in_shape[3] +
-                                     *map_index[3]) * elem_size,
-                               elem_size);
-                        out += elem_size;
+                    memcpy(dst,
+                           in + (i0 * in_strides[0] +
+                                 i1 * in_strides[1] +
+                                 i2 * in_strides[2] +
+                                 i3 * in_strides[3]) * elem_size,
+                           elem_size);
+                    dst += elem_size;
                     // clang-format on
                 }
             }
         }
-    }
+    });
 }
 
 void reshape_in5(const char* in,
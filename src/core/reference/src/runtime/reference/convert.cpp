@@ -4,7 +4,10 @@
 
 #include "ngraph/runtime/reference/convert.hpp"
 
+#include <algorithm>
+
 #include "jit_generator.hpp"
+#include "openvino/core/parallel.hpp"
 
 namespace ngraph {
 namespace runtime {
@@ -179,18 +182,27 @@ public:
     }
 };
 
+// Number of elements converted by a single task. Conversions of large constants (e.g. decompression of
+// f16 weights during constant folding) are split into blocks of this size and processed in parallel.
+constexpr size_t convert_block_size = 64 * 1024;
+
 template <typename TI, typename TO>
 void convert_impl(const TI* arg, TO* out, size_t count) {
     auto converter = jit_convert_array::get<TI, TO>();
 
-    if (converter) {
-        jit_convert_array::args_t args = {arg, out, count};
-        converter(&args);
-    } else {
-        for (size_t i = 0; i < count; ++i) {
-            out[i] = static_cast<TO>(arg[i]);
+    const size_t blocks = (count + convert_block_size - 1) / convert_block_size;
+    ov::parallel_for(blocks, [&](size_t block) {
+        const size_t offset = block * convert_block_size;
+        const size_t size = std::min(convert_block_size, count - offset);
+        if (converter) {
+            jit_convert_array::args_t args = {arg + offset, out + offset, size};
+            converter(&args);
+        } else {
+            for (size_t i = offset; i < offset + size; ++i) {
+                out[i] = static_cast<TO>(arg[i]);
+            }
         }
-    }
+    });
 }
 }  // namespace
 
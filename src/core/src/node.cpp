@@ -820,8 +820,11 @@ bool ov::Node::constant_fold(OutputVector& output_values, const OutputVector& in
     for (const auto& input : input_values) {
         nodes.push_back(input.get_node_shared_ptr());
         auto constant = ov::as_type_ptr<ngraph::op::v0::Constant>(input.get_node_shared_ptr());
-        auto tensor = ov::Tensor(input.get_element_type(), input.get_shape());
-        std::copy_n(constant->get_data_ptr<uint8_t>(), constant->get_byte_size(), static_cast<uint8_t*>(tensor.data()));
+        // Inputs are read-only for evaluate, so wrap constant data instead of copying it: for large weights
+        // the copy doubles peak memory of the folding.
+        auto tensor = ov::Tensor(input.get_element_type(),
+                                 input.get_shape(),
+                                 const_cast<void*>(constant->get_data_ptr()));
         input_tensors.push_back(tensor);
     }
 
@@ -56,7 +56,12 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    auto ordered_ops = model->get_ordered_ops();
+    for (auto& ordered_op : ordered_ops) {
+        // Move the node out of the list so that it is destroyed as soon as it is processed. A folded node keeps
+        // its input constants alive, so holding it until the end of the pass would keep every intermediate
+        // constant of a folded sub-graph alive until the whole model is processed.
+        const auto node = std::move(ordered_op);
         if (rewritten) {
             node->validate_and_infer_types();
         }
@@ -4,6 +4,8 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <chrono>
+#include <iostream>
 #include <transformations/utils/utils.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -15,6 +17,10 @@
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
+#ifdef __linux__
+#    include <sys/resource.h>
+#endif
+
 using namespace ngraph;
 using namespace std;
 
@@ -3584,3 +3590,106 @@ TEST(constant_folding, evaluate_on_tensor_vector) {
     ASSERT_EQ(data_shape, result_node->get_output_shape(0));
     ASSERT_EQ(add_expected, result_node->cast_vector<int>());
 }
+
+TEST(constant_folding, intermediate_constants_are_released) {
+    vector<int> values{1, 2, 3, 4};
+    auto data_shape = Shape{2, 2};
+    auto a = make_shared<op::Constant>(element::i32, data_shape, values);
+    auto b = make_shared<op::Constant>(element::i32, data_shape, values);
+
+    std::weak_ptr<Node> intermediate;
+    auto mock = [&]() {
+        auto add = make_shared<op::v1::Add>(a, b);
+        intermediate = add;
+        return std::make_shared<::testing::StrictMock<MockAddOp>>(add, a);
+    }();
+    auto mock_ptr = mock.get();
+    EXPECT_CALL(*mock, evaluate)
+        .WillOnce([&](ov::TensorVector& outputs, const ov::TensorVector& inputs) {
+            // already folded producer must not be kept alive until the end of the pass
+            EXPECT_TRUE(intermediate.expired());
+            return mock_ptr->ov::Node::evaluate(outputs, inputs);
+        });
+
+    auto model = std::make_shared<ov::Model>(NodeVector{mock}, ParameterVector{});
+    mock.reset();
+
+    run_constant_folding(model);
+
+    vector<int> expected{3, 6, 9, 12};
+    auto result_node = get_result_constant(model);
+    ASSERT_TRUE(result_node);
+    ASSERT_EQ(expected, result_node->cast_vector<int>());
+}
+
+#ifdef __linux__
+static size_t peak_rss_kb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<size_t>(usage.ru_maxrss);
+}
+#else
+static size_t peak_rss_kb() {
+    return 0;
+}
+#endif
+
+// Benchmark of folding weight decompression sub-graphs (Convert -> Multiply -> Transpose) of a large synthetic
+// model, run it with --gtest_also_run_disabled_tests. Reports the elapsed time and the growth of the peak RSS,
+// which stays close to the size of the folded weights when the intermediate constants are released early.
+TEST(constant_folding, DISABLED_decompression_of_large_model) {
+    const size_t blocks = 16;
+    const Shape weights_shape{1024, 4096};
+    const size_t weights_size = shape_size(weights_shape);
+
+    std::vector<std::weak_ptr<Node>> intermediates;
+    ParameterVector params;
+    ResultVector results;
+    {
+        NodeVector outputs;
+        for (size_t block = 0; block < blocks; ++block) {
+            std::vector<uint8_t> values(weights_size);
+            for (size_t i = 0; i < weights_size; ++i) {
+                values[i] = static_cast<uint8_t>((i + block) % 256);
+            }
+            auto weights = make_shared<op::Constant>(element::u8, weights_shape, values);
+            auto convert = make_shared<opset5::Convert>(weights, element::f32);
+            auto scale = make_shared<op::Constant>(element::f32, Shape{weights_shape[0], 1}, vector<float>{0.5f});
+            auto multiply = make_shared<opset5::Multiply>(convert, scale);
+            auto order = make_shared<op::Constant>(element::i64, Shape{2}, vector<int64_t>{1, 0});
+            auto transpose = make_shared<opset5::Transpose>(multiply, order);
+            intermediates.push_back(convert);
+            intermediates.push_back(multiply);
+            results.push_back(make_shared<op::Result>(transpose));
+        }
+    }
+    auto model = std::make_shared<ov::Model>(results, params);
+    results.clear();
+
+    const auto rss_before = peak_rss_kb();
+    const auto start = std::chrono::steady_clock::now();
+    run_constant_folding(model);
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+    const auto rss_after = peak_rss_kb();
+
+    std::cout << "Folded " << blocks << " decompression sub-graphs of " << weights_shape << " in " << elapsed.count()
+              << " ms, peak RSS grew by " << (rss_after - rss_before) / 1024 << " MB (folded weights take "
+              << blocks * weights_size * sizeof(float) / (1024 * 1024) << " MB)" << std::endl;
+
+    for (const auto& intermediate : intermediates) {
+        EXPECT_TRUE(intermediate.expired());
+    }
+    for (size_t block = 0; block < blocks; ++block) {
+        auto result_node = get_result_constant(model, block);
+        ASSERT_TRUE(result_node);
+        ASSERT_EQ((Shape{weights_shape[1], weights_shape[0]}), result_node->get_output_shape(0));
+        const auto data = result_node->get_data_ptr<float>();
+        // out[c][r] = in[r][c] * 0.5
+        for (size_t r : {size_t{0}, size_t{1}, weights_shape[0] - 1}) {
+            for (size_t c : {size_t{0}, size_t{7}, weights_shape[1] - 1}) {
+                const auto expected = static_cast<float>((r * weights_shape[1] + c + block) % 256) * 0.5f;
+                ASSERT_EQ(expected, data[c * weights_shape[0] + r]);
+            }
+        }
+    }
+}
@@ -4,6 +4,7 @@
 
 #include "ir_deserializer.hpp"
 
+#include <exception>
 #include <pugixml.hpp>
 #include <regex>
 
@@ -12,6 +13,7 @@
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
@@ -430,13 +432,28 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
-    // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+    // Parse generic parameters of all layers in parallel: it only reads the xml tree
+    std::vector<pugi::xml_node> layer_nodes;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { layer_nodes.push_back(node); }
+    std::vector<GenericLayerParams> layer_params(layer_nodes.size());
+    std::vector<std::exception_ptr> layer_errors(layer_nodes.size());
+    ov::parallel_for(layer_nodes.size(), [&](size_t i) {
+        try {
+            layer_params[i] = parseGenericParams(layer_nodes[i]);
+        } catch (...) {
+            layer_errors[i] = std::current_exception();
+        }
+    });
+
+    // Store layers parameters in params map keeping the xml order for diagnostics and Parameters order
+    for (size_t i = 0; i < layer_nodes.size(); ++i) {
+        if (layer_errors[i])
+            std::rethrow_exception(layer_errors[i]);
+        const auto& node_param = layer_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
+        params[node_param.layerId] = {layer_nodes[i], node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -459,16 +476,25 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     }
 
     // Run DFS starting from outputs to get nodes topological order
-    std::function<void(size_t)> dfs = [&edges, &order, &dfs_used_nodes, &dfs](const size_t id) {
-        if (dfs_used_nodes.count(id))
-            return;
-        dfs_used_nodes.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    // Explicit stack is used instead of recursion as deep models (long chains of layers) overflow the call stack
+    std::vector<std::pair<size_t /*layer-id*/, size_t /*next edge index*/>> dfs_stack;
+    for (const auto& output_id : outputs) {
+        if (!dfs_used_nodes.insert(output_id).second)
+            continue;
+        dfs_stack.emplace_back(output_id, 0);
+        while (!dfs_stack.empty()) {
+            const size_t id = dfs_stack.back().first;
+            const auto& id_edges = edges[id];
+            if (dfs_stack.back().second < id_edges.size()) {
+                const size_t from_id = id_edges[dfs_stack.back().second++].fromLayerId;
+                if (dfs_used_nodes.insert(from_id).second)
+                    dfs_stack.emplace_back(from_id, 0);
+            } else {
+                order.push_back(id);
+                dfs_stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
@@ -753,36 +779,22 @@ static const std::string& translate_type_name(const std::string& name) {
     return name;
 }
 
-std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
-    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
-    const pugi::xml_node& node,
-    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
-    const GenericLayerParams& params) {
-    // Check that inputs are correctly defined
-    for (size_t i = 0; i < inputs.size(); i++) {
-        if (!inputs[i].get_node())
-            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
-                       << " has incorrect input with index " << i << "!";
-        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
-            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
-                       << " has undefined element type for input with index " << i << "!";
-    }
+const XmlDeserializer::OpDispatch& XmlDeserializer::getOpDispatch(const GenericLayerParams& params) {
+    auto it = m_op_dispatch.find({params.version, params.type});
+    if (it != m_op_dispatch.end())
+        return it->second;
 
-    const std::string& type_name = translate_type_name(params.type);
+    OpDispatch dispatch;
+    dispatch.type_name = translate_type_name(params.type);
 
-    std::shared_ptr<ngraph::Node> ngraphNode;
-    ov::DiscreteTypeInfo type(type_name.c_str(), 0, params.version.c_str());
+    ov::DiscreteTypeInfo type(dispatch.type_name.c_str(), 0, params.version.c_str());
     auto extensionIt = m_extensions.find(type);
-
-    if (extensionIt != m_extensions.end()) {
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
-        ngraphNode = (*extensionIt->second).create(inputs, visitor).at(0).get_node_shared_ptr();
-    }
+    if (extensionIt != m_extensions.end())
+        dispatch.extension = extensionIt->second;
 
     // Find registered opset
     auto opsetIt = m_opsets.find(params.version);
 
-    // Try to create operation from loaded opsets
     static const std::unordered_set<std::string> experimental_ops_added_to_opset = {
         "ExperimentalDetectronDetectionOutput",
         "ExperimentalDetectronGenerateProposalsSingleImage",
@@ -793,24 +805,57 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
         "RNNCell",
         "Proposal"};
 
-    if (experimental_ops_added_to_opset.count(type_name) &&
+    if (experimental_ops_added_to_opset.count(dispatch.type_name) &&
         (params.version == "experimental" || params.version == "extension")) {
         opsetIt = m_opsets.find("opset6");
     }
 
-    if (!ngraphNode && opsetIt != m_opsets.end()) {
-        if (params.version == "opset1") {
-            // MVN, ROIPooling and ReorgYolo were missing in opset1
-            if (type_name == "MVN" || type_name == "ROIPooling" || type_name == "ReorgYolo") {
-                opsetIt = m_opsets.find("opset2");
-                if (opsetIt == m_opsets.end()) {
-                    IE_THROW() << "Cannot create " << params.type << " layer " << params.name
-                               << " id:" << params.layerId << " from unsupported opset: " << params.version;
-                }
-            }
+    if (opsetIt != m_opsets.end() && params.version == "opset1") {
+        // MVN, ROIPooling and ReorgYolo were missing in opset1
+        const auto& type_name = dispatch.type_name;
+        if (type_name == "MVN" || type_name == "ROIPooling" || type_name == "ReorgYolo") {
+            opsetIt = m_opsets.find("opset2");
+            dispatch.unsupported_opset = opsetIt == m_opsets.end();
         }
+    }
+    if (opsetIt != m_opsets.end())
+        dispatch.opset = &opsetIt->second;
 
-        auto const& opset = opsetIt->second;
+    return m_op_dispatch.emplace(std::make_pair(params.version, params.type), std::move(dispatch)).first->second;
+}
+
+std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
+    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
+    const pugi::xml_node& node,
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+    const GenericLayerParams& params) {
+    // Check that inputs are correctly defined
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!inputs[i].get_node())
+            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
+                       << " has incorrect input with index " << i << "!";
+        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
+            IE_THROW() << params.type << " layer " << params.name << " with id: " << params.layerId
+                       << " has undefined element type for input with index " << i << "!";
+    }
+
+    const auto& dispatch = getOpDispatch(params);
+    const std::string& type_name = dispatch.type_name;
+
+    std::shared_ptr<ngraph::Node> ngraphNode;
+    if (dispatch.extension) {
+        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        ngraphNode = dispatch.extension->create(inputs, visitor).at(0).get_node_shared_ptr();
+    }
+
+    if (!ngraphNode && dispatch.unsupported_opset) {
+        IE_THROW() << "Cannot create " << params.type << " layer " << params.name << " id:" << params.layerId
+                   << " from unsupported opset: " << params.version;
+    }
+
+    // Try to create operation from loaded opsets
+    if (!ngraphNode && dispatch.opset) {
+        auto const& opset = *dispatch.opset;
 
         ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type_name));
         if (!ngraphNode) {
@@ -6,6 +6,7 @@
 
 #include <cctype>
 #include <istream>
+#include <map>
 #include <memory>
 #include <pugixml.hpp>
 
@@ -175,6 +176,17 @@ private:
 
     GenericLayerParams parseGenericParams(const pugi::xml_node& node);
 
+    /// \brief Describes how layers of one type and version are created, it is resolved once per type
+    struct OpDispatch {
+        std::string type_name;
+        ov::BaseOpExtension::Ptr extension;
+        const ov::OpSet* opset = nullptr;
+        // the layer version names an opset which lacks the type and the opset it is moved to isn't loaded
+        bool unsupported_opset = false;
+    };
+
+    const OpDispatch& getOpDispatch(const GenericLayerParams& params);
+
     std::shared_ptr<ov::Node> createNode(const ov::OutputVector& inputs,
                                          const pugi::xml_node& node,
                                          const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
@@ -199,6 +211,8 @@ private:
     ///
     IoMap io_map;
 
+    std::map<std::pair<std::string /*version*/, std::string /*type*/>, OpDispatch> m_op_dispatch;
+
     int64_t m_version;
 };
 }  // namespace ov
@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
 #include "frontend_test.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
@@ -1387,3 +1391,83 @@ TEST_F(IRFrontendTests, DetectionOutput) {
     ASSERT_NO_THROW(model = getWithIRFrontend(testModel));
     ASSERT_TRUE(!!model);
 }
+
+TEST_F(IRFrontendTests, model_with_deep_chain_of_layers) {
+    // The chain is deep enough to overflow the call stack if layers are ordered recursively
+    const size_t chain_length = 100000;
+    const std::string port = R"V0G0N(<port id="0" precision="FP32"><dim>1</dim><dim>8</dim></port>)V0G0N";
+    std::stringstream layers, edges;
+    layers << R"V0G0N(<layer name="input" type="Parameter" id="0" version="opset1">)V0G0N"
+           << R"V0G0N(<data element_type="f32" shape="1,8"/><output>)V0G0N" << port << "</output></layer>\n";
+    for (size_t id = 1; id <= chain_length; ++id) {
+        layers << "<layer name=\"relu_" << id << "\" type=\"ReLU\" id=\"" << id << "\" version=\"opset1\">"
+               << "<input>" << port << "</input><output>" << port << "</output></layer>\n";
+        edges << "<edge from-layer=\"" << id - 1 << "\" from-port=\"0\" to-layer=\"" << id << "\" to-port=\"0\"/>\n";
+    }
+    layers << "<layer name=\"output\" type=\"Result\" id=\"" << chain_length + 1 << "\" version=\"opset1\">"
+           << "<input>" << port << "</input></layer>\n";
+    edges << "<edge from-layer=\"" << chain_length << "\" from-port=\"0\" to-layer=\"" << chain_length + 1
+          << "\" to-port=\"0\"/>\n";
+    const std::string testModel = "<net name=\"Network\" version=\"11\"><layers>\n" + layers.str() +
+                                  "</layers><edges>\n" + edges.str() + "</edges></net>\n";
+
+    std::shared_ptr<ov::Model> model;
+
+    ASSERT_NO_THROW(model = getWithIRFrontend(testModel));
+    ASSERT_TRUE(!!model);
+    const auto ordered_ops = model->get_ordered_ops();
+    ASSERT_EQ(chain_length + 2, ordered_ops.size());
+    EXPECT_EQ("input", ordered_ops.front()->get_friendly_name());
+    EXPECT_EQ("relu_1", ordered_ops[1]->get_friendly_name());
+    EXPECT_EQ("relu_" + std::to_string(chain_length), ordered_ops[chain_length]->get_friendly_name());
+    EXPECT_EQ(ov::PartialShape({1, 8}), model->get_result()->get_output_partial_shape(0));
+}
+
+// Benchmark of reading a large synthetic IR, run it with --gtest_also_run_disabled_tests
+TEST_F(IRFrontendTests, DISABLED_read_time_of_large_model) {
+    const size_t blocks = 50000;
+    const std::string port = R"V0G0N(<port id="0" precision="FP32"><dim>1</dim><dim>8</dim></port>)V0G0N";
+    const std::string two_inputs = R"V0G0N(<input><port id="0" precision="FP32"><dim>1</dim><dim>8</dim></port>)V0G0N"
+                                   R"V0G0N(<port id="1" precision="FP32"><dim>1</dim><dim>8</dim></port></input>)V0G0N";
+    std::stringstream layers, edges;
+    const auto edge = [&edges](size_t from_layer, size_t from_port, size_t to_layer, size_t to_port) {
+        edges << "<edge from-layer=\"" << from_layer << "\" from-port=\"" << from_port << "\" to-layer=\""
+              << to_layer << "\" to-port=\"" << to_port << "\"/>\n";
+    };
+    layers << R"V0G0N(<layer name="input" type="Parameter" id="0" version="opset1">)V0G0N"
+           << R"V0G0N(<data element_type="f32" shape="1,8"/><output>)V0G0N" << port << "</output></layer>\n";
+    // every block is Const -> Add -> ReLU, all the constants share the weights
+    size_t id = 1;
+    size_t prev = 0;
+    for (size_t block = 0; block < blocks; ++block, id += 3) {
+        layers << "<layer name=\"const_" << block << "\" type=\"Const\" id=\"" << id << "\" version=\"opset1\">"
+               << R"V0G0N(<data element_type="f32" shape="1,8" offset="0" size="32"/>)V0G0N"
+               << "<output>" << port << "</output></layer>\n"
+               << "<layer name=\"add_" << block << "\" type=\"Add\" id=\"" << id + 1 << "\" version=\"opset1\">"
+               << two_inputs << R"V0G0N(<output><port id="2" precision="FP32"><dim>1</dim><dim>8</dim></port>)V0G0N"
+               << "</output></layer>\n"
+               << "<layer name=\"relu_" << block << "\" type=\"ReLU\" id=\"" << id + 2 << "\" version=\"opset1\">"
+               << "<input>" << port << "</input><output>" << port << "</output></layer>\n";
+        edge(prev, 0, id + 1, 0);
+        edge(id, 0, id + 1, 1);
+        edge(id + 1, 2, id + 2, 0);
+        prev = id + 2;
+    }
+    layers << "<layer name=\"output\" type=\"Result\" id=\"" << id << "\" version=\"opset1\">"
+           << "<input>" << port << "</input></layer>\n";
+    edge(prev, 0, id, 0);
+    const std::string testModel = "<net name=\"Network\" version=\"11\"><layers>\n" + layers.str() +
+                                  "</layers><edges>\n" + edges.str() + "</edges></net>\n";
+
+    ov::Tensor weights(ov::element::f32, ov::Shape{8});
+    std::fill_n(weights.data<float>(), weights.get_size(), 0.5f);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(testModel, weights));
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    ASSERT_TRUE(!!model);
+    ASSERT_EQ(3 * blocks + 2, model->get_ops().size());
+    std::cout << "Read " << model->get_ops().size() << " layers in " << duration.count() << " ms" << std::endl;
+}
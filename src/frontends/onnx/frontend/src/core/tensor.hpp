@@ -106,10 +106,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -237,13 +240,7 @@ private:
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         int data_size = get_data_size();
         if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-            if (constant->get_byte_size() != external_data.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
+            constant = make_external_data_constant(type);
         } else if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
@@ -265,14 +262,29 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
-        auto data = get_data<T>();
-        auto data_size = data.size();
-        if (data_size == shape_size(m_shape)) {
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, data);
-        } else if (data_size == 0 && m_shape.size() == 0) {
-            constant = common::make_failsafe_constant(type);
+        if (has_external_data()) {
+            constant = make_external_data_constant(type);
+        } else if (m_tensor_proto->has_raw_data()) {
+            // raw data has the same binary layout as the constant, so there is no need
+            // to convert it to std::vector first
+            const auto data_size = get_data_size();
+            if (data_size == shape_size(m_shape)) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, m_tensor_proto->raw_data().data());
+            } else if (data_size == 0 && m_shape.size() == 0) {
+                constant = common::make_failsafe_constant(type);
+            } else {
+                throw error::tensor::shape_doesnt_match_data_size{};
+            }
         } else {
-            throw error::tensor::shape_doesnt_match_data_size{};
+            auto data = get_data<T>();
+            auto data_size = data.size();
+            if (data_size == shape_size(m_shape)) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, data);
+            } else if (data_size == 0 && m_shape.size() == 0) {
+                constant = common::make_failsafe_constant(type);
+            } else {
+                throw error::tensor::shape_doesnt_match_data_size{};
+            }
         }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
@@ -286,6 +298,18 @@ private:
                    ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
     }
 
+    /// \brief Creates a constant which shares memory mapped external data instead of copying it.
+    std::shared_ptr<ngraph::op::Constant> make_external_data_constant(const element::Type& type) const {
+        const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        auto buffer = tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+        if (buffer->size() != shape_size(m_shape) * type.size()) {
+            throw error::invalid_external_data(
+                "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                "' in the model");
+        }
+        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+    }
+
     std::string load_external_data() const {
         const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
         return tensor_external_data.load_external_data(m_model_dir);
@@ -337,6 +361,7 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
@@ -6,9 +6,23 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief Files mapped into memory while loading external data, shared by all tensors of a model
+///        so that each external data file is mapped only once.
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+
+/// \brief Buffer which points into a memory mapped external data file and keeps the mapping alive.
+using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +37,18 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map external data from tensor passed to constructor into memory
+    ///
+    /// \note       Data is not copied, returned buffer points directly into the mapped file.
+    ///             If mapping of the external file fails, the invalid_external_data exception is thrown.
+    ///
+    /// \param      model_dir  Directory of the model the external data paths are relative to
+    /// \param      cache      Already mapped files, may be nullptr
+    ///
+    /// \return     Buffer which shares the mapped external data
+    std::shared_ptr<MappedBuffer> load_external_mmap_data(const std::string& model_dir,
+                                                          const MappedMemoryHandles& cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
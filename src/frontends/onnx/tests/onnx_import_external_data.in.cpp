@@ -111,6 +111,41 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_mapped_once_per_model) {
+    const auto model_path =
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx");
+    const auto get_constant = [](const std::shared_ptr<Function>& function, const std::string& name) {
+        for (const auto& op : function->get_ops()) {
+            if (op->get_friendly_name() == name) {
+                if (const auto constant = ov::as_type_ptr<default_opset::Constant>(op))
+                    return constant;
+            }
+        }
+        return std::shared_ptr<default_opset::Constant>{};
+    };
+
+    auto first = onnx_import::import_onnx_model(model_path);
+    const auto second = onnx_import::import_onnx_model(model_path);
+    for (const auto& function : {first, second}) {
+        const auto data_a = get_constant(function, "data_a");
+        const auto data_b = get_constant(function, "data_b");
+        ASSERT_TRUE(data_a && data_b);
+        EXPECT_EQ(std::vector<int32_t>({3, 2, 1}), data_a->cast_vector<int32_t>());
+        EXPECT_EQ(std::vector<int32_t>({1, 2, 3}), data_b->cast_vector<int32_t>());
+        // both initializers point into the same mapping of the file instead of copies of the data
+        EXPECT_EQ(4096, data_b->get_data_ptr<char>() - data_a->get_data_ptr<char>());
+    }
+
+    // the mapping is owned by the constants of each model, so it outlives the other model
+    first.reset();
+    auto test_case = test::TestCase(second, s_device);
+    test_case.add_input<int32_t>({2, 3, 1});
+    test_case.add_expected_output<int32_t>({3, 3, 3});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -8,6 +8,7 @@
 #include "node_def.pb.h"
 #include "openvino/frontend/tensorflow/node_context.hpp"
 #include "openvino/frontend/tensorflow/special_types.hpp"
+#include "openvino/runtime/allocator.hpp"
 #include "types.pb.h"
 
 namespace ov {
@@ -86,25 +87,52 @@ void extract_compressed_tensor_content(const ::tensorflow::TensorProto& tensor_p
         }
     }
 }
+
+// Exposes tensor_content of a TensorProto as memory of ov::Tensor without copying it.
+// The owner of the protobuf message is kept alive until the last tensor using the content is destroyed.
+class SharedProtoAllocator : public ov::AllocatorImpl {
+public:
+    SharedProtoAllocator(const std::string& content, const std::shared_ptr<void>& proto_holder)
+        : m_data(const_cast<char*>(content.data())),
+          m_size(content.size()),
+          m_proto_holder(proto_holder) {}
+
+    void* allocate(const size_t bytes, const size_t alignment) override {
+        FRONT_END_GENERAL_CHECK(bytes <= m_size, "Size of tensor is not equal to tensor_content size.");
+        return m_data;
+    }
+
+    void deallocate(void* handle, const size_t bytes, size_t alignment) override {}
+
+    bool is_equal(const AllocatorImpl& other) const override {
+        const auto other_shared = dynamic_cast<const SharedProtoAllocator*>(&other);
+        return other_shared != nullptr && other_shared->m_data == m_data;
+    }
+
+private:
+    char* m_data;
+    size_t m_size;
+    std::shared_ptr<void> m_proto_holder;
+};
 }  // namespace
 
 ov::Any DecoderProto::get_attribute(const std::string& name) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
+    const auto attr = decode_attribute_helper(name);
+    if (!attr) {
         return {};
     }
 
-    switch (attrs[0].value_case()) {
+    switch (attr->value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kB:
-        return attrs[0].b();
+        return attr->b();
     case ::tensorflow::AttrValue::ValueCase::kF:
-        return attrs[0].f();
+        return attr->f();
     case ::tensorflow::AttrValue::ValueCase::kS:
-        return attrs[0].s();
+        return attr->s();
     case ::tensorflow::AttrValue::ValueCase::kI:
-        return attrs[0].i();
+        return attr->i();
     case ::tensorflow::AttrValue::ValueCase::kShape: {
-        const auto& tf_shape = attrs[0].shape();
+        const auto& tf_shape = attr->shape();
         if (tf_shape.unknown_rank()) {
             return ov::PartialShape::dynamic();
         }
@@ -117,8 +145,8 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kType: {
-        if (TYPE_MAP().count(attrs[0].type())) {
-            return TYPE_MAP().at(attrs[0].type());
+        if (TYPE_MAP().count(attr->type())) {
+            return TYPE_MAP().at(attr->type());
         } else {
             // for all unsupported types return undefined type
             return ov::element::undefined;
@@ -126,7 +154,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kList: {
-        const auto& list = attrs[0].list();
+        const auto& list = attr->list();
         if (list.i_size())
             return std::vector<int64_t>(list.i().begin(), list.i().end());
 
@@ -178,7 +206,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kTensor: {
-        const auto& tensor_proto = attrs[0].tensor();
+        const auto& tensor_proto = attr->tensor();
         const auto& tf_shape = tensor_proto.tensor_shape();
         ov::PartialShape pshape;
         for (int i = 0; i < tf_shape.dim_size(); i++) {
@@ -190,8 +218,15 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
             TYPE_MAP().count(tf_type),
             "Encountered unknown element type " + DataType_Name(tf_type) + " on an empty tensor_proto");
         auto ov_type = TYPE_MAP().at(tf_type);
+        const auto& tensor_content = tensor_proto.tensor_content();
+        if (m_proto_holder && !tensor_content.empty() && tensor_proto.has_tensor_shape() &&
+            ov_type != ov::element::boolean &&
+            tensor_content.size() == shape_size(pshape.get_shape()) * ov_type.size()) {
+            // share the dense content with the protobuf message rather than copying potentially huge weights
+            auto allocator = std::make_shared<SharedProtoAllocator>(tensor_content, m_proto_holder);
+            return ov::Tensor(ov_type, pshape.get_shape(), ov::Allocator(allocator));
+        }
         ov::Tensor res(ov_type, pshape.get_shape());
-        auto tensor_content = tensor_proto.tensor_content();
         if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
             switch (ov_type) {
             case ov::element::u8:
@@ -263,11 +298,11 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
                                 name,
                                 "' attribute is not supported.");
     case ::tensorflow::AttrValue::ValueCase::kFunc:
-        // attrs[0].func() returns NameAttrList object from which
+        // attr->func() returns NameAttrList object from which
         // we retrieve the function name
         // Further, InputModel object is created for FunctionDef with this name
         // and is converted to ov::Model object.
-        return attrs[0].func().name();
+        return attr->func().name();
     default:
         FRONT_END_GENERAL_CHECK(false, "Conversion from Tensorflow to OpenVINO data type failed.");
     }
@@ -307,14 +342,10 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    if (attr_map.contains(name)) {
-        auto value = m_node_def->attr().at(name);
-        return {value};
-    } else {
-        return {};
-    }
+const ::tensorflow::AttrValue* DecoderProto::decode_attribute_helper(const std::string& name) const {
+    const auto& attr_map = m_node_def->attr();
+    const auto it = attr_map.find(name);
+    return it != attr_map.end() ? &it->second : nullptr;
 }
 }  // namespace tensorflow
 }  // namespace frontend
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -20,7 +21,13 @@ namespace tensorflow {
 
 class DecoderProto : public ov::frontend::tensorflow::DecoderBase {
 public:
-    explicit DecoderProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
+    /// \param node_def Node definition to decode
+    /// \param proto_holder Optional owner of the protobuf message that contains node_def. When it is provided,
+    /// dense tensor attributes are returned as views into the protobuf memory instead of being copied, and
+    /// the owner is kept alive as long as such tensors exist.
+    explicit DecoderProto(const ::tensorflow::NodeDef* node_def, const std::shared_ptr<void>& proto_holder = nullptr)
+        : m_node_def(node_def),
+          m_proto_holder(proto_holder) {}
 
     ov::Any get_attribute(const std::string& name) const override;
 
@@ -35,8 +42,9 @@ public:
     const std::string& get_op_name() const override;
 
 private:
-    std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
+    const ::tensorflow::AttrValue* decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
+    std::shared_ptr<void> m_proto_holder;
 };
 }  // namespace tensorflow
 }  // namespace frontend
@@ -50,7 +50,7 @@ public:
 
         // fill all node defs from library functions
         for (int node_ind = 0; node_ind < nodes_size; ++node_ind) {
-            m_decoders.push_back(std::make_shared<DecoderProto>(&(m_func_def->node_def(node_ind))));
+            m_decoders.push_back(std::make_shared<DecoderProto>(&(m_func_def->node_def(node_ind)), m_func_def));
         }
 
         // fill all outputs from library functions
@@ -76,7 +76,7 @@ public:
         auto nodes_size = m_graph_def->node_size();
         m_decoders.resize(static_cast<size_t>(nodes_size));
         for (int node_ind = 0; node_ind < nodes_size; ++node_ind) {
-            m_decoders[node_ind] = std::make_shared<DecoderProto>(&m_graph_def->node(node_ind));
+            m_decoders[node_ind] = std::make_shared<DecoderProto>(&m_graph_def->node(node_ind), m_graph_def);
         }
 
         // initialize a library map
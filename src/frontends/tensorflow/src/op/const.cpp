@@ -3,6 +3,7 @@
 //
 
 #include "helper_ops/unsupported_constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "op_table.hpp"
 #include "openvino/opsets/opset8.hpp"
 
@@ -22,7 +23,11 @@ OutputVector translate_const_op(const NodeContext& node) {
         const_node = std::make_shared<UnsupportedConstant>();
     } else {
         auto tensor = node.get_attribute<Tensor>("value");
-        const_node = std::make_shared<Constant>(tensor.get_element_type(), tensor.get_shape(), tensor.data());
+        // the constant keeps the tensor alive and reuses its memory, so weights are not duplicated
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Tensor>>(static_cast<char*>(tensor.data()),
+                                                                               tensor.get_byte_size(),
+                                                                               tensor);
+        const_node = std::make_shared<Constant>(tensor.get_element_type(), tensor.get_shape(), buffer);
     }
     set_node_name(node.get_name(), const_node);
     return {const_node};
@@ -77,6 +77,50 @@ TEST(FrontEndConvertTrickyModels, simple_wide_and_deep) {
     ASSERT_EQ(num_emb_segment_sum, 1) << "The number of EmbeddingSegmentsSum nodes must be 1";
 }
 
+TEST(FrontEndConvertTrickyModels, const_shares_tensor_content) {
+    FrontEndManager fem;
+    auto front_end = fem.load_by_framework(TF_FE);
+    ASSERT_NE(front_end, nullptr);
+    auto model_filename = FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                             "const_with_tensor_content/const_with_tensor_content.pb");
+    auto input_model = front_end->load(model_filename);
+    ASSERT_NE(input_model, nullptr);
+
+    // the same input model is converted twice
+    auto first = front_end->convert(input_model);
+    auto second = front_end->convert(input_model);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    const auto get_weights = [](const shared_ptr<Model>& model) -> shared_ptr<Constant> {
+        for (const auto& node : model->get_ordered_ops()) {
+            if (node->get_friendly_name() == "weights") {
+                return as_type_ptr<Constant>(node);
+            }
+        }
+        return nullptr;
+    };
+    auto first_weights = get_weights(first);
+    auto second_weights = get_weights(second);
+    ASSERT_NE(first_weights, nullptr);
+    ASSERT_NE(second_weights, nullptr);
+    // both constants alias tensor_content of the parsed GraphDef instead of copying it
+    EXPECT_EQ(first_weights->get_data_ptr(), second_weights->get_data_ptr());
+
+    // the constants keep the GraphDef memory alive after the frontend objects are released
+    input_model.reset();
+    front_end.reset();
+    const vector<float> expected{1.f, 2.f, 3.f, 4.f};
+    EXPECT_EQ(expected, first_weights->cast_vector<float>());
+    first.reset();
+    first_weights.reset();
+    EXPECT_EQ(expected, second_weights->cast_vector<float>());
+    for (const auto& node : second->get_ordered_ops()) {
+        if (as_type_ptr<Add>(node)) {
+            EXPECT_EQ(second_weights, node->get_input_node_shared_ptr(1));
+        }
+    }
+}
+
 TEST(FrontEndConvertTrickyModels, model_with_output_shapes) {
     shared_ptr<Model> model;
     try {
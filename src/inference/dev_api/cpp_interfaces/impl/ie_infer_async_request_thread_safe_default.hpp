@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <exception>
 #include <future>
 #include <map>
@@ -292,6 +294,15 @@ public:
         }
     }
 
+    void SetSchedulingHint(ov::hint::Priority priority,
+                           std::chrono::milliseconds deadline,
+                           bool dropExpired) override {
+        CheckState();
+        _schedulingHint._priority = priority;
+        _relativeDeadline = deadline;
+        _dropExpired = dropExpired;
+    }
+
     void setModelInputsOutputs(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
                                const std::vector<std::shared_ptr<const ov::Node>>& outputs) override {
         _parameters = inputs;
@@ -322,7 +333,34 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        _schedulingHint._deadline = _relativeDeadline != std::chrono::milliseconds::zero()
+                                        ? std::chrono::steady_clock::now() + _relativeDeadline
+                                        : std::chrono::steady_clock::time_point::max();
+        RunStage(firstStageExecutor, MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor), true));
+    }
+
+    /**
+     * @brief Passes the scheduling hint of the running inference to a request of another device that executes a part
+     * of it. The deadline is passed as the time left, so the device request drops the inference if it is expired.
+     * @note Device requests started after others of the same inference never get dropExpired, as the inference is
+     * completed once started
+     * @param[in]  request A device request, should be idle
+     * @param[in]  started Whether device requests of this inference are already started
+     */
+    void ForwardSchedulingHint(IInferRequestInternal& request, bool started = false) const {
+        auto deadline = std::chrono::milliseconds::zero();
+        if (_relativeDeadline != std::chrono::milliseconds::zero()) {
+            const auto now = std::chrono::steady_clock::now();
+            const auto timeLeft =
+                std::chrono::duration_cast<std::chrono::milliseconds>(_schedulingHint._deadline - now);
+            deadline = _schedulingHint._deadline > now ? std::max(timeLeft, std::chrono::milliseconds{1})
+                                                       : std::min(timeLeft, std::chrono::milliseconds{-1});
+        }
+        try {
+            request.SetSchedulingHint(_schedulingHint._priority, deadline, _dropExpired && !started);
+        } catch (const NotImplemented&) {
+            // the device runs the request without the hint
+        }
     }
 
     /**
@@ -381,6 +419,30 @@ protected:
     }
 
 private:
+    /**
+     * @brief Passes the stage task to the executor. Streams executors get the request scheduling hint
+     * to order the task among tasks of other requests.
+     * @param[in]  executor Executor of the stage
+     * @param[in]  task Stage task
+     */
+    void RunStage(const ITaskExecutor::Ptr& executor, Task task) {
+        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(executor);
+        if (nullptr != streamsExecutor) {
+            streamsExecutor->ScheduleTask(std::move(task), _schedulingHint);
+        } else {
+            executor->run(std::move(task));
+        }
+    }
+
+    /**
+     * @brief Throws InferCancelled exception if the request deadline is expired and expired requests should be dropped
+     */
+    void ThrowIfExpired() const {
+        if (_dropExpired && std::chrono::steady_clock::now() > _schedulingHint._deadline) {
+            IE_THROW(InferCancelled) << "Infer request is dropped as its deadline expired before execution";
+        }
+    }
+
     /**
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
@@ -391,25 +453,32 @@ private:
      * @param[in]  itStage Iterator to next stage of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Executor that will run final stage with callback call
+     * @param[in]  firstStage Whether the stage is the first one, the request deadline is checked before it
      * @return A next stage task
      */
     Task MakeNextStageTask(const Pipeline::iterator itStage,
                            const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
+                           const ITaskExecutor::Ptr callbackExecutor,
+                           bool firstStage = false) {
         return std::bind(
-            [this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
+            [this, itStage, itEndStage, firstStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
                 std::exception_ptr currentException = nullptr;
                 auto& thisStage = *itStage;
                 auto itNextStage = itStage + 1;
                 try {
                     auto& stageTask = std::get<Stage_e::task>(thisStage);
                     IE_ASSERT(nullptr != stageTask);
+                    // once started, the inference is completed even if the deadline expires meanwhile
+                    if (firstStage) {
+                        ThrowIfExpired();
+                    }
                     stageTask();
                     if (itEndStage != itNextStage) {
                         auto& nextStage = *itNextStage;
                         auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                         IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                        RunStage(nextStageExecutor,
+                                 MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
                     }
                 } catch (...) {
                     currentException = std::current_exception();
@@ -456,5 +525,8 @@ private:
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
+    IStreamsExecutor::SchedulingHint _schedulingHint;
+    std::chrono::milliseconds _relativeDeadline{0};
+    bool _dropExpired = false;
 };
 }  // namespace InferenceEngine
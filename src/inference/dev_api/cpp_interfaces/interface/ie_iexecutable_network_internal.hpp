@@ -167,6 +167,20 @@ public:
      */
     bool isLoadedFromCache() const;
 
+    /**
+     * @brief Sets durations of the model loading phases measured by the core
+     *
+     * @param loadingTimeDetails A map of a phase name to its duration in milliseconds
+     */
+    void setLoadingTimeDetails(const std::map<std::string, float>& loadingTimeDetails);
+
+    /**
+     * @brief Provides durations of the model loading phases
+     *
+     * @return A map of a phase name to its duration in milliseconds
+     */
+    std::map<std::string, float> getLoadingTimeDetails() const;
+
 protected:
     virtual ~IExecutableNetworkInternal() = default;
 
@@ -213,6 +227,11 @@ protected:
      * @brief If true, it means that model was loaded from cache
      */
     bool _loadedFromCache = false;
+
+    /**
+     * @brief Durations of the model loading phases in milliseconds
+     */
+    std::map<std::string, float> _loadingTimeDetails;
 };
 
 /**
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -14,6 +15,7 @@
 #include "ie_input_info.hpp"
 #include "ie_preprocess_data.hpp"
 #include "openvino/core/node_output.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "so_ptr.hpp"
 
 namespace InferenceEngine {
@@ -196,6 +198,17 @@ public:
      */
     virtual void SetCallback(Callback callback);
 
+    /**
+     * @brief Sets priority class and deadline used to order this request among other ready requests
+     * @note The default implementation throws NotImplemented exception
+     * @param priority Priority class of the request
+     * @param deadline Time since the start of inference the request should be finished by, zero means no deadline.
+     *        A negative deadline is already expired when the inference starts
+     * @param dropExpired If `true` the request is failed with InferCancelled exception instead of being executed
+     *        when its deadline expires before the first pipeline stage is started
+     */
+    virtual void SetSchedulingHint(ov::hint::Priority priority, std::chrono::milliseconds deadline, bool dropExpired);
+
     /**
      * @brief      Check that @p blob is valid. Throws an exception if it's not.
      *
@@ -92,6 +92,35 @@ DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines the period of sampled inferences for which the CPU plugin collects per node execution time
+ * histograms even if performance counters are disabled. Zero (default) disables sampling
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_SAMPLING_PERIOD);
+
+/**
+ * @brief Path of the Chrome trace (chrome://tracing) file to which the CPU plugin dumps node executions of
+ * profiled inferences when the compiled model is destroyed. Empty string (default) disables the dump
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_TRACE_FILE);
+
+/**
+ * @brief Number of asynchronous inference requests whose input preprocessing the CPU plugin runs on a separate
+ * executor while inference streams compute other requests. Zero (default) runs preprocessing on the inference stream
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PREPROCESSING_PIPELINE_DEPTH);
+
+/**
+ * @brief Name of the shared memory segment keeping constants and repacked weights of the model compiled by the CPU
+ * plugin. Processes compiling or importing the same model with the same name map one copy of the data.
+ * Empty (default) keeps the data in process memory
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WEIGHTS_SEGMENT);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -51,6 +51,12 @@ static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get percentiles of execution time of the executable primitive, e.g. "p50:1.2,p90:1.5,p99:3.1".
+ */
+static const char PERF_COUNTER_PERCENTILES[] = "execTimePercentilesMcs";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief Used to get output layouts of primitive.
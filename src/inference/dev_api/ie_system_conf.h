@@ -83,6 +83,13 @@ INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx();
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx2();
 
+/**
+ * @brief      Checks whether CPU supports AVX2 VNNI capability
+ * @ingroup    ie_dev_api_system_conf
+ * @return     `True` is AVX2, AVX_VNNI instructions are available, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx2_vnni();
+
 /**
  * @brief      Checks whether CPU supports AVX 512 capability
  * @ingroup    ie_dev_api_system_conf
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -20,7 +21,7 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from single queue ordered by priority class and deadline of tasks.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -44,6 +45,10 @@ public:
 
     void Execute(Task task) override;
 
+    void ScheduleTask(Task task, const SchedulingHint& hint) override;
+
+    std::map<ov::hint::Priority, QueueingStatistics> GetQueueingStatistics() const override;
+
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
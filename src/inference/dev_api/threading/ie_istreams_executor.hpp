@@ -9,11 +9,14 @@
 
 #pragma once
 
+#include <chrono>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "ie_parameter.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "threading/ie_itask_executor.hpp"
 
 namespace InferenceEngine {
@@ -166,6 +169,43 @@ public:
      * @param task A task to start
      */
     virtual void Execute(Task task) = 0;
+
+    /**
+     * @brief Scheduling attributes of a task. Ready tasks of a higher priority class are started first,
+     *        tasks of the same class are started in the order of their deadlines and then in FIFO order.
+     */
+    struct SchedulingHint {
+        ov::hint::Priority _priority = ov::hint::Priority::MEDIUM;  //!< Priority class of the task
+        std::chrono::steady_clock::time_point _deadline =
+            std::chrono::steady_clock::time_point::max();  //!< Time point the task should be finished by
+    };
+
+    /**
+     * @brief Queueing delay of tasks of one priority class, measured from enqueueing to start of the execution
+     */
+    struct QueueingStatistics {
+        std::size_t _count = 0;               //!< Number of started tasks
+        std::chrono::microseconds _total{0};  //!< Sum of queueing delays of the started tasks
+        std::chrono::microseconds _max{0};    //!< Maximal queueing delay
+    };
+
+    /**
+     * @brief Enqueues the task using the scheduling hint to order it among other ready tasks
+     * @note The default implementation ignores the hint and calls ITaskExecutor::run
+     * @param task A task to start
+     * @param hint Priority class and deadline of the task
+     */
+    virtual void ScheduleTask(Task task, const SchedulingHint& hint) {
+        run(std::move(task));
+    }
+
+    /**
+     * @brief Returns the queueing delay statistics collected by the executor per priority class
+     * @return Statistics per priority class, empty if the executor does not collect them
+     */
+    virtual std::map<ov::hint::Priority, QueueingStatistics> GetQueueingStatistics() const {
+        return {};
+    }
 };
 
 }  // namespace InferenceEngine
@@ -42,5 +42,15 @@ DECLARE_CPU_CONFIG_KEY(DENORMALS_OPTIMIZATION);
 
 DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_DECOMPRESSION_RATE);
 
+/**
+ * @brief The name for enabling runtime INT8 quantization of FullyConnected activations on CPU
+ *
+ * FP32 activations are quantized per row (token) and weights per output channel without calibration,
+ * the accuracy in this mode should be verified separately by the user.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(DYNAMIC_QUANTIZATION);
+
 }  // namespace CPUConfigParams
 }  // namespace InferenceEngine
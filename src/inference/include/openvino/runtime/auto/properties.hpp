@@ -18,5 +18,12 @@ namespace intel_auto {
  */
 static constexpr Property<bool> device_bind_buffer{"DEVICE_BIND_BUFFER"};
 
+/**
+ * @brief Read-only property with per device scheduling statistics of a MULTI compiled model.
+ * Maps device name to the number of completed and in-flight requests ("COMPLETED", "IN_FLIGHT") and the
+ * exponentially weighted moving average of the request latency in milliseconds ("LATENCY_EWMA_MS")
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> device_statistics{"DEVICE_STATISTICS"};
+
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
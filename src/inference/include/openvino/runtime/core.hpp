@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -322,6 +323,103 @@ public:
         return compile_model(model, context, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Creates a compiled model from a source model object on the default OpenVINO device selected by AUTO
+     * plugin without blocking the caller.
+     *
+     * Models are compiled on a pool of ov::compile_model_async_threads threads owned by the Core object,
+     * so independent models are compiled at the same time. The Core object waits for the queued models in its
+     * destructor.
+     *
+     * @param model Model object acquired from Core::read_model.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future with the compiled model. An exception thrown by the compilation is rethrown by its get().
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Creates a compiled model from a source model object without blocking the caller.
+     *
+     * Models are compiled on a pool of ov::compile_model_async_threads threads owned by the Core object,
+     * so independent models are compiled at the same time. The Core object waits for the queued models in its
+     * destructor.
+     *
+     * @param model Model object acquired from Core::read_model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future with the compiled model. An exception thrown by the compilation is rethrown by its get().
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Creates a compiled model from a source model object without blocking the caller.
+     * @tparam Properties Should be the pack of `std::pair<std::string, ov::Any>` types
+     * @param model Model object acquired from Core::read_model
+     * @param device_name Name of device to load model to
+     * @param properties Optional pack of pairs: (property name, property value) relevant only for this
+     * load operation
+     * @return A future with the compiled model
+     */
+    template <typename... Properties>
+    util::EnableIfAllStringAny<std::future<CompiledModel>, Properties...> compile_model_async(
+        const std::shared_ptr<const ov::Model>& model,
+        const std::string& device_name,
+        Properties&&... properties) {
+        return compile_model_async(model, device_name, AnyMap{std::forward<Properties>(properties)...});
+    }
+
+    /**
+     * @brief Reads and loads a compiled model from the IR/ONNX/PDPD file to the default OpenVINO device selected by
+     * the AUTO plugin without blocking the caller.
+     *
+     * Reading of the model or its import from the cache is done on the compile thread too, so
+     * cache reads of some models overlap with compilation of the others.
+     *
+     * @param model_path Path to a model.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future with the compiled model. An exception thrown by the compilation is rethrown by its get().
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path, const AnyMap& properties = {});
+
+    /**
+     * @brief Reads and loads a compiled model from the IR/ONNX/PDPD file to a device without blocking the caller.
+     *
+     * Reading of the model or its import from the cache is done on the compile thread too, so
+     * cache reads of some models overlap with compilation of the others.
+     *
+     * @param model_path Path to a model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future with the compiled model. An exception thrown by the compilation is rethrown by its get().
+     */
+    std::future<CompiledModel> compile_model_async(const std::string& model_path,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Reads and loads a compiled model from the IR/ONNX/PDPD file to a device without blocking the caller.
+     * @tparam Properties Should be the pack of `std::pair<std::string, ov::Any>` types
+     * @param model_path Path to a model
+     * @param device_name Name of device to load model to
+     * @param properties Optional pack of pairs: (property name, property value) relevant only for this
+     * load operation
+     * @return A future with the compiled model
+     */
+    template <typename... Properties>
+    util::EnableIfAllStringAny<std::future<CompiledModel>, Properties...> compile_model_async(
+        const std::string& model_path,
+        const std::string& device_name,
+        Properties&&... properties) {
+        return compile_model_async(model_path, device_name, AnyMap{std::forward<Properties>(properties)...});
+    }
+
     /**
      * @deprecated This method is deprecated. Please use other Core::add_extension methods.
      * @brief Registers OpenVINO 1.0 extension to a Core object.
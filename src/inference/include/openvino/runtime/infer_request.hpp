@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -16,6 +17,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
@@ -310,6 +312,20 @@ public:
      */
     void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets the priority class and the deadline of subsequent inferences of the infer request.
+     *
+     * Ready requests of the same compiled model are started by the priority class first and then
+     * by the earliest deadline.
+     * @param priority Priority class of the infer request.
+     * @param deadline Time since the inference start the request should be finished by. Zero means no deadline.
+     * @param drop_expired If true, the inference fails with the ov::Cancelled exception instead of being executed
+     * once its deadline is expired.
+     */
+    void set_scheduling_hint(ov::hint::Priority priority,
+                             const std::chrono::milliseconds deadline = std::chrono::milliseconds{0},
+                             bool drop_expired = false);
+
     /**
      * @brief Gets state control interface for the given infer request.
      *
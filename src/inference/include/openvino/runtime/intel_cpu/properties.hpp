@@ -49,5 +49,18 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
 
 static constexpr Property<float> sparse_weights_decompression_rate{"SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines whether FullyConnected layers quantize FP32 activations to INT8 at runtime.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Activations are quantized per row (token) and weights per output channel, so INT8 GEMM is used for models
+ * without FakeQuantize nodes from calibration. The accuracy in this mode should be verified by the user.
+ *
+ * @code
+ * ie.set_property(ov::intel_cpu::dynamic_quantization(true));
+ * @endcode
+ */
+static constexpr Property<bool> dynamic_quantization{"CPU_DYNAMIC_QUANTIZATION"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -472,6 +472,22 @@ static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
  */
 static constexpr Property<bool, PropertyMutability::RO> loaded_from_cache{"LOADED_FROM_CACHE"};
 
+/**
+ * @brief Read-only property with durations of the compiled model loading phases in milliseconds
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * Only the phases the model went through are reported:
+ *  - "READ" - reading of the model file or model string
+ *  - "HASH" - computation of the model hash for the cache
+ *  - "CACHE_LOCK" - waiting for another compilation of the same model to write the cache
+ *  - "CACHE_READ" - reading and importing of the compiled blob from the cache
+ *  - "COMPILE" - device transformations and compilation of the model
+ *  - "CACHE_WRITE" - export of the compiled blob to the cache
+ *  - "QUEUE" - waiting for a thread of ov::Core::compile_model_async
+ */
+static constexpr Property<std::map<std::string, float>, PropertyMutability::RO> loading_time_details{
+    "LOADING_TIME_DETAILS"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  * @ingroup ov_runtime_cpp_prop_api
@@ -533,6 +549,14 @@ static constexpr Property<std::tuple<unsigned int, unsigned int, unsigned int>,
  */
 static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FORCE_TBB_TERMINATE"};
 
+/**
+ * @brief Read-write property to set the number of threads ov::Core::compile_model_async compiles models with
+ * value type: uint32_t, 4 or the number of physical cores if it is smaller by default
+ * @note Changing the value waits for the models already queued by ov::Core::compile_model_async
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> compile_model_async_threads{"COMPILE_MODEL_ASYNC_THREADS"};
+
 /**
  * @brief Namespace with device properties
  */
@@ -906,4 +930,12 @@ static constexpr Property<Affinity> affinity{"AFFINITY"};
  * @ingroup ov_runtime_cpp_prop_api
  */
 static constexpr Property<std::vector<std::string>, PropertyMutability::RO> execution_devices{"EXECUTION_DEVICES"};
+
+/**
+ * @brief Read-only property to get queueing delay of infer requests per priority class.
+ * Maps the priority class name (see ov::hint::Priority) to ov::AnyMap with `COUNT` of started requests,
+ * `AVERAGE_US` and `MAX_US` queueing delays in microseconds.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> queueing_statistics{"QUEUEING_STATISTICS"};
 }  // namespace ov
@@ -12,12 +12,25 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/variable.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
@@ -43,6 +56,393 @@ static int32_t as_int32_t(T v) {
 
 //////////////////////////////////////////////////
 
+namespace {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+// Buffers are split into chunks hashed in parallel, chunk hashes are combined in order
+constexpr size_t hash_chunk_size = 1 << 20;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read_u64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t read_u32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t hash_round(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    return rotl(acc, 31) * prime1;
+}
+
+inline uint64_t hash_merge(uint64_t hash, uint64_t acc) {
+    hash ^= hash_round(0, acc);
+    return hash * prime1 + prime4;
+}
+
+/**
+ * 64-bit hash of a contiguous memory block (xxHash64 scheme).
+ * Four independent accumulators consume 32 bytes per iteration, so the loop is bound by memory bandwidth
+ * rather than by the latency of a single multiply chain like hash_combine of every word is.
+ */
+uint64_t hash_memory(const uint8_t* p, size_t size) {
+    const uint8_t* const end = p + size;
+    uint64_t hash;
+    if (size >= 32) {
+        uint64_t acc[4] = {prime1 + prime2, prime2, 0, 0 - prime1};
+        const uint8_t* const limit = end - 32;
+        do {
+            for (int i = 0; i < 4; i++)
+                acc[i] = hash_round(acc[i], read_u64(p + 8 * i));
+            p += 32;
+        } while (p <= limit);
+        hash = rotl(acc[0], 1) + rotl(acc[1], 7) + rotl(acc[2], 12) + rotl(acc[3], 18);
+        for (int i = 0; i < 4; i++)
+            hash = hash_merge(hash, acc[i]);
+    } else {
+        hash = prime5;
+    }
+    hash += size;
+
+    for (; p + 8 <= end; p += 8) {
+        hash ^= hash_round(0, read_u64(p));
+        hash = rotl(hash, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        hash ^= read_u32(p) * prime1;
+        hash = rotl(hash, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        hash ^= (*p) * prime5;
+        hash = rotl(hash, 11) * prime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/**
+ * Hashes a set of memory buffers, e.g. constants of a model, in parallel by chunks of hash_chunk_size.
+ * Small buffers are hashed in parallel with each other and large ones are split between threads.
+ */
+std::vector<uint64_t> hash_buffers(const std::vector<std::pair<const uint8_t*, size_t>>& buffers) {
+    struct Chunk {
+        size_t buffer;
+        const uint8_t* data;
+        size_t size;
+    };
+    std::vector<Chunk> chunks;
+    for (size_t i = 0; i < buffers.size(); i++) {
+        const auto& buffer = buffers[i];
+        size_t offset = 0;
+        do {
+            const size_t size = std::min(hash_chunk_size, buffer.second - offset);
+            chunks.push_back({i, buffer.first + offset, size});
+            offset += size;
+        } while (offset < buffer.second);
+    }
+
+    std::vector<uint64_t> chunk_hashes(chunks.size());
+    InferenceEngine::parallel_for(chunks.size(), [&](size_t i) {
+        chunk_hashes[i] = hash_memory(chunks[i].data, chunks[i].size);
+    });
+
+    std::vector<uint64_t> hashes(buffers.size());
+    for (size_t i = 0, first = 0; i < buffers.size(); i++) {
+        size_t last = first;
+        while (last < chunks.size() && chunks[last].buffer == i)
+            last++;
+        hashes[i] = last - first == 1 ? chunk_hashes[first]
+                                      : hash_memory(reinterpret_cast<const uint8_t*>(chunk_hashes.data() + first),
+                                                    (last - first) * sizeof(uint64_t));
+        first = last;
+    }
+    return hashes;
+}
+
+/**
+ * Calculates hash of a model from its structure, attributes of operations and constant data.
+ * The model is visited directly without serialization to IR. Constant buffers are collected during the visit
+ * and hashed afterwards in parallel, buffers shared by several constants are hashed once.
+ */
+class ModelHasher : public ov::AttributeVisitor {
+public:
+    void hash_model(const ov::Model& model) {
+        const auto ops = model.get_ordered_ops();
+        std::unordered_map<const ov::Node*, size_t> ids;
+        ids.reserve(ops.size());
+        combine(model.get_friendly_name());
+        combine(ops.size());
+        for (size_t i = 0; i < ops.size(); i++) {
+            const auto& op = ops[i];
+            ids[op.get()] = i;
+            const auto& type_info = op->get_type_info();
+            combine(std::string(type_info.name));
+            combine(std::string(type_info.version_id ? type_info.version_id : ""));
+            combine(op->get_friendly_name());
+            for (const auto& input : op->inputs()) {
+                const auto& source = input.get_source_output();
+                combine(ids.at(source.get_node()));
+                combine(source.get_index());
+                combine_rt_info(input.get_rt_info());
+            }
+            for (const auto& output : op->outputs()) {
+                combine(output.get_element_type().get_type_name());
+                combine(output.get_partial_shape().to_string());
+                const auto& names = output.get_names();
+                std::vector<std::string> sorted_names(names.begin(), names.end());
+                std::sort(sorted_names.begin(), sorted_names.end());
+                for (const auto& name : sorted_names)
+                    combine(name);
+                combine_rt_info(output.get_rt_info());
+            }
+            op->visit_attributes(*this);
+        }
+        for (const auto& parameter : model.get_parameters())
+            combine(ids.at(parameter.get()));
+        for (const auto& result : model.get_results())
+            combine(ids.at(result.get()));
+        for (const auto& sink : model.get_sinks())
+            combine(ids.at(sink.get()));
+    }
+
+    /**
+     * @return false if the model has attributes the hasher doesn't know, the hash must not be used then
+     */
+    bool is_supported() const {
+        return m_supported;
+    }
+
+    uint64_t get_hash() const {
+        uint64_t seed = m_seed;
+        for (const auto hash : hash_buffers(m_buffers))
+            seed = hash_combine(seed, hash);
+        return seed;
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        using InputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>;
+        using SliceInput = ov::op::util::MultiSubGraphOp::SliceInputDescription;
+        using MergedInput = ov::op::util::MultiSubGraphOp::MergedInputDescription;
+        using ConcatOutput = ov::op::util::MultiSubGraphOp::ConcatOutputDescription;
+        using BodyOutput = ov::op::util::MultiSubGraphOp::BodyOutputDescription;
+
+        combine(name);
+        if (const auto& a =
+                ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            add_buffer(static_cast<const uint8_t*>(a->get()->get_ptr()), a->get()->size());
+        } else if (const auto& a =
+                       ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            combine(info.variable_id);
+            combine(info.data_type.get_type_name());
+            combine(info.data_shape.to_string());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            combine(attrs.get_type_name());
+            combine(attrs.get_opset_name());
+            std::map<std::string, std::string> sorted_attrs(attrs.begin(), attrs.end());
+            for (const auto& attr : sorted_attrs) {
+                combine(attr.first);
+                combine(attr.second);
+            }
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get())
+                combine(type.get_type_name());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            combine(a->get().to_string());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            std::stringstream strm;
+            strm << a->get();
+            combine(strm.str());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<InputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                combine(std::string(desc->get_type_info().name));
+                combine(desc->m_input_index);
+                combine(desc->m_body_parameter_index);
+                if (const auto slice = ov::as_type_ptr<SliceInput>(desc)) {
+                    combine_slice(*slice);
+                } else if (const auto merged = ov::as_type_ptr<MergedInput>(desc)) {
+                    combine(merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                combine(std::string(desc->get_type_info().name));
+                combine(desc->m_body_value_index);
+                combine(desc->m_output_index);
+                if (const auto concat = ov::as_type_ptr<ConcatOutput>(desc)) {
+                    combine_slice(*concat);
+                } else if (const auto body = ov::as_type_ptr<BodyOutput>(desc)) {
+                    combine(body->m_iteration);
+                }
+            }
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            combine(a->get().current_iteration_input_idx);
+            combine(a->get().body_condition_output_idx);
+        } else {
+            m_supported = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        combine(name);
+        hash_model(*adapter.get());
+    }
+
+private:
+    template <typename T>
+    void combine(const T& value) {
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void combine_vector(const std::string& name, const std::vector<T>& values) {
+        combine(name);
+        combine(values.size());
+        for (const auto& value : values)
+            combine(value);
+    }
+
+    template <typename T>
+    void combine_slice(const T& desc) {
+        combine(desc.m_start);
+        combine(desc.m_stride);
+        combine(desc.m_part_size);
+        combine(desc.m_end);
+        combine(desc.m_axis);
+    }
+
+    void combine_rt_info(const ov::RTMap& rt_info) {
+        for (const auto& item : rt_info) {
+            combine(item.first);
+            std::stringstream strm;
+            item.second.print(strm);
+            combine(strm.str());
+        }
+    }
+
+    void add_buffer(const uint8_t* data, size_t size) {
+        const auto key = std::make_pair(data, size);
+        auto it = m_buffer_ids.find(key);
+        if (it == m_buffer_ids.end()) {
+            it = m_buffer_ids.emplace(key, m_buffers.size()).first;
+            m_buffers.push_back(key);
+        }
+        combine(it->second);
+        combine(size);
+    }
+
+    uint64_t m_seed = 0;
+    bool m_supported = true;
+    std::vector<std::pair<const uint8_t*, size_t>> m_buffers;
+    std::map<std::pair<const uint8_t*, size_t>, size_t> m_buffer_ids;
+};
+
+}  // namespace
+
+//////////////////////////////////////////////////
+
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
     uint64_t seed = 0;
     auto absPath = filePath;
@@ -63,6 +463,12 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
     return std::to_string(seed);
 }
 
+bool NetworkCompilationContext::isHashedWithoutSerialization(const ov::Model& model) {
+    ModelHasher hasher;
+    hasher.hash_model(model);
+    return hasher.is_supported();
+}
+
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                                    const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
@@ -74,9 +480,19 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
     m.run_passes(net.getFunction());
 
+    ModelHasher hasher;
+    hasher.hash_model(*net.getFunction());
+    if (hasher.is_supported()) {
+        seed = hasher.get_hash();
+    } else {
+        // fall back to hash of serialized IR for attributes the hasher doesn't know
+        ov::pass::Manager hashManager;
+        hashManager.register_pass<ov::pass::Hash>(seed);
+        hashManager.run_passes(net.getFunction());
+    }
+
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
@@ -150,16 +566,7 @@ std::string NetworkCompilationContext::computeHash(const std::string& modelStr,
 
     // tensor data
     seed = hash_combine(seed, tensor.get_size());
-
-    auto ptr = static_cast<size_t*>(tensor.data());
-    size_t size = tensor.get_size() / sizeof(size_t);
-    for (size_t i = 0; i < size; i++)
-        seed = hash_combine(seed, ptr[i]);
-    auto size_done = size * sizeof(size_t);
-    auto ptr_left = static_cast<uint8_t*>(tensor.data()) + size_done;
-    size_t size_left = tensor.get_size() - size_done;
-    for (size_t i = 0; i < size_left; i++)
-        seed = hash_combine(seed, ptr_left[i]);
+    seed = hash_combine(seed, hash_buffers({{static_cast<const uint8_t*>(tensor.data()), tensor.get_byte_size()}})[0]);
 
     // compile options
     for (const auto& kvp : compileOptions) {
@@ -10,6 +10,7 @@
 #include <string>
 
 namespace ov {
+class Model;
 class Tensor;
 }  // namespace ov
 
@@ -22,6 +23,12 @@ struct NetworkCompilationContext final {
 
     static std::string computeHash(const CNNNetwork& network, const std::map<std::string, std::string>& compileOptions);
 
+    /**
+     * @return true if the hash of the model is calculated from the model directly, false if it falls back to
+     * the hash of the model serialized to IR
+     */
+    static bool isHashedWithoutSerialization(const ov::Model& model);
+
     static std::string computeHash(const std::string& modelName,
                                    const std::map<std::string, std::string>& compileOptions);
     static std::string computeHash(const std::string& modeStr,
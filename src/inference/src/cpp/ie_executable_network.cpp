@@ -217,6 +217,9 @@ Any CompiledModel::get_property(const std::string& name) const {
         if (ov::loaded_from_cache == name) {
             return _impl->isLoadedFromCache();
         }
+        if (ov::loading_time_details == name) {
+            return _impl->getLoadingTimeDetails();
+        }
         if (ov::supported_properties == name) {
             try {
                 auto supported_properties = _impl->GetMetric(name).as<std::vector<PropertyName>>();
@@ -243,6 +246,7 @@ Any CompiledModel::get_property(const std::string& name) const {
                 }
                 supported_properties.emplace_back(ov::supported_properties.name(), PropertyMutability::RO);
                 supported_properties.emplace_back(ov::loaded_from_cache.name(), PropertyMutability::RO);
+                supported_properties.emplace_back(ov::loading_time_details.name(), PropertyMutability::RO);
                 return supported_properties;
             }
         }
@@ -493,6 +493,12 @@ void InferRequest::set_callback(std::function<void(std::exception_ptr)> callback
     OV_INFER_REQ_CALL_STATEMENT(_impl->SetCallback(std::move(callback));)
 }
 
+void InferRequest::set_scheduling_hint(ov::hint::Priority priority,
+                                       const std::chrono::milliseconds deadline,
+                                       bool drop_expired) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->SetSchedulingHint(priority, deadline, drop_expired);)
+}
+
 std::vector<VariableState> InferRequest::query_state() {
     std::vector<VariableState> variable_states;
     std::vector<std::shared_ptr<void>> soVec;
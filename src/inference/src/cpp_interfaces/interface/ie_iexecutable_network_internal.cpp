@@ -125,6 +125,14 @@ bool IExecutableNetworkInternal::isLoadedFromCache() const {
     return _loadedFromCache;
 }
 
+void IExecutableNetworkInternal::setLoadingTimeDetails(const std::map<std::string, float>& loadingTimeDetails) {
+    _loadingTimeDetails = loadingTimeDetails;
+}
+
+std::map<std::string, float> IExecutableNetworkInternal::getLoadingTimeDetails() const {
+    return _loadingTimeDetails;
+}
+
 std::shared_ptr<IInferRequestInternal> IExecutableNetworkInternal::CreateInferRequestImpl(
     const std::vector<std::shared_ptr<const ov::Node>>& inputs,
     const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
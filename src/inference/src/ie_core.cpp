@@ -6,10 +6,14 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include <vector>
 
@@ -30,6 +34,7 @@
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_remote_context.hpp"
+#include "ie_system_conf.h"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset.hpp"
@@ -247,6 +252,9 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
         bool flag_allow_auto_batching = true;
 
+        std::atomic<uint32_t> compile_model_async_threads{
+            static_cast<uint32_t>(std::max(1, std::min(4, ie::getNumberOfCPUCores())))};
+
         void setAndUpdate(ov::AnyMap& config) {
             auto it = config.find(CONFIG_KEY(CACHE_DIR));
             if (it != config.end()) {
@@ -271,6 +279,14 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 flag_allow_auto_batching = flag;
                 config.erase(it);
             }
+
+            it = config.find(ov::compile_model_async_threads.name());
+            if (it != config.end()) {
+                auto threads = it->second.as<uint32_t>();
+                OPENVINO_ASSERT(threads > 0, "Wrong value for property key ", ov::compile_model_async_threads.name());
+                compile_model_async_threads = threads;
+                config.erase(it);
+            }
         }
 
         void setCacheForDevice(const std::string& dir, const std::string& name) {
@@ -410,25 +426,57 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         return util::contains(plugin.get_property(ov::supported_properties), ov::cache_dir);
     }
 
+    // Durations of the model loading phases in milliseconds, see ov::loading_time_details
+    using LoadingTimeDetails = std::map<std::string, float>;
+
+    // Adds the time till the end of its scope to the phase
+    class PhaseTimer {
+    public:
+        PhaseTimer(LoadingTimeDetails& loadingTime, const char* phase)
+            : _loadingTime(loadingTime),
+              _phase(phase),
+              _start(std::chrono::steady_clock::now()) {}
+        ~PhaseTimer() {
+            _loadingTime[_phase] +=
+                std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - _start).count();
+        }
+
+    private:
+        LoadingTimeDetails& _loadingTime;
+        const char* _phase;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    template <typename F>
+    static auto measure(LoadingTimeDetails& loadingTime, const char* phase, F&& f) -> decltype(f()) {
+        PhaseTimer timer(loadingTime, phase);
+        return f();
+    }
+
     ov::SoPtr<ie::IExecutableNetworkInternal> compile_model_impl(const InferenceEngine::CNNNetwork& network,
                                                                  ov::InferencePlugin& plugin,
                                                                  const std::map<std::string, std::string>& parsedConfig,
                                                                  const ie::RemoteContext::Ptr& context,
                                                                  const CacheContent& cacheContent,
+                                                                 LoadingTimeDetails& loadingTime,
                                                                  bool forceDisableCache = false) {
         OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CoreImpl::compile_model_impl");
         ov::SoPtr<ie::IExecutableNetworkInternal> execNetwork;
-        execNetwork = context ? plugin.compile_model(network, context, parsedConfig)
-                              : plugin.compile_model(network, parsedConfig);
+        execNetwork = measure(loadingTime, "COMPILE", [&] {
+            return context ? plugin.compile_model(network, context, parsedConfig)
+                           : plugin.compile_model(network, parsedConfig);
+        });
         if (!forceDisableCache && cacheContent.cacheManager && DeviceSupportsImportExport(plugin)) {
             try {
                 // need to export network for further import from "cache"
                 OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Export");
-                cacheContent.cacheManager->writeCacheEntry(cacheContent.blobId, [&](std::ostream& networkStream) {
-                    networkStream << ie::CompiledBlobHeader(
-                        ie::GetInferenceEngineVersion()->buildNumber,
-                        ie::NetworkCompilationContext::calculateFileInfo(cacheContent.modelPath));
-                    execNetwork->Export(networkStream);
+                measure(loadingTime, "CACHE_WRITE", [&] {
+                    cacheContent.cacheManager->writeCacheEntry(cacheContent.blobId, [&](std::ostream& networkStream) {
+                        networkStream << ie::CompiledBlobHeader(
+                            ie::GetInferenceEngineVersion()->buildNumber,
+                            ie::NetworkCompilationContext::calculateFileInfo(cacheContent.modelPath));
+                        execNetwork->Export(networkStream);
+                    });
                 });
             } catch (...) {
                 cacheContent.cacheManager->removeCacheEntry(cacheContent.blobId);
@@ -443,11 +491,13 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         ov::InferencePlugin& plugin,
         const std::map<std::string, std::string>& config,
         const std::shared_ptr<ie::RemoteContext>& context,
-        bool& networkIsImported) {
+        bool& networkIsImported,
+        LoadingTimeDetails& loadingTime) {
         ov::SoPtr<ie::IExecutableNetworkInternal> execNetwork;
         struct HeaderException {};
 
         OPENVINO_ASSERT(cacheContent.cacheManager != nullptr);
+        PhaseTimer timer(loadingTime, "CACHE_READ");
         try {
             cacheContent.cacheManager->readCacheEntry(cacheContent.blobId, [&](std::istream& networkStream) {
                 OV_ITT_SCOPE(FIRST_INFERENCE,
@@ -720,20 +770,26 @@ public:
             coreConfig.getCacheConfigForDevice(parsed._deviceName, DeviceSupportsCacheDir(plugin), parsed._config)
                 ._cacheManager;
         auto cacheContent = CacheContent{cacheManager};
+        LoadingTimeDetails loadingTime;
         if (cacheManager && DeviceSupportsImportExport(plugin)) {
-            cacheContent.blobId = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
+            cacheContent.blobId = measure(loadingTime, "HASH", [&] {
+                return CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
+            });
             bool loadedFromCache = false;
-            auto lock = cacheGuard.getHashLock(cacheContent.blobId);
-            res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, context, loadedFromCache);
+            auto lock = measure(loadingTime, "CACHE_LOCK", [&] {
+                return cacheGuard.getHashLock(cacheContent.blobId);
+            });
+            res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, context, loadedFromCache, loadingTime);
             if (!loadedFromCache) {
-                res = compile_model_impl(network, plugin, parsed._config, context, cacheContent);
+                res = compile_model_impl(network, plugin, parsed._config, context, cacheContent, loadingTime);
             } else {
                 // Temporary workaround until all plugins support caching of original model inputs
                 InferenceEngine::SetExeNetworkInfo(res._ptr, network.getFunction(), isNewAPI());
             }
         } else {
-            res = compile_model_impl(network, plugin, parsed._config, context, cacheContent);
+            res = compile_model_impl(network, plugin, parsed._config, context, cacheContent, loadingTime);
         }
+        res->setLoadingTimeDetails(loadingTime);
         return res;
     }
 
@@ -839,20 +895,38 @@ public:
             coreConfig.getCacheConfigForDevice(parsed._deviceName, DeviceSupportsCacheDir(plugin), parsed._config)
                 ._cacheManager;
         auto cacheContent = CacheContent{cacheManager};
+        LoadingTimeDetails loadingTime;
         if (!forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin)) {
-            cacheContent.blobId = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
+            cacheContent.blobId = measure(loadingTime, "HASH", [&] {
+                return CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
+            });
             bool loadedFromCache = false;
-            auto lock = cacheGuard.getHashLock(cacheContent.blobId);
-            res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, nullptr, loadedFromCache);
+            auto lock = measure(loadingTime, "CACHE_LOCK", [&] {
+                return cacheGuard.getHashLock(cacheContent.blobId);
+            });
+            res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, nullptr, loadedFromCache, loadingTime);
             if (!loadedFromCache) {
-                res = compile_model_impl(network, plugin, parsed._config, nullptr, cacheContent, forceDisableCache);
+                res = compile_model_impl(network,
+                                         plugin,
+                                         parsed._config,
+                                         nullptr,
+                                         cacheContent,
+                                         loadingTime,
+                                         forceDisableCache);
             } else {
                 // Temporary workaround until all plugins support caching of original model inputs
                 InferenceEngine::SetExeNetworkInfo(res._ptr, network.getFunction(), isNewAPI());
             }
         } else {
-            res = compile_model_impl(network, plugin, parsed._config, nullptr, cacheContent, forceDisableCache);
-        }
+            res = compile_model_impl(network,
+                                     plugin,
+                                     parsed._config,
+                                     nullptr,
+                                     cacheContent,
+                                     loadingTime,
+                                     forceDisableCache);
+        }
+        res->setLoadingTimeDetails(loadingTime);
         return {res._ptr, res._so};
     }
 
@@ -868,28 +942,41 @@ public:
             coreConfig.getCacheConfigForDevice(parsed._deviceName, DeviceSupportsCacheDir(plugin), parsed._config)
                 ._cacheManager;
         auto cacheContent = CacheContent{cacheManager, modelPath};
+        LoadingTimeDetails loadingTime;
+        auto readNetwork = [&] {
+            return measure(loadingTime, "READ", [&] {
+                return ReadNetwork(modelPath, std::string());
+            });
+        };
         if (cacheManager && DeviceSupportsImportExport(plugin)) {
             bool loadedFromCache = false;
-            cacheContent.blobId = CalculateFileHash(modelPath, parsed._deviceName, plugin, parsed._config);
-            auto lock = cacheGuard.getHashLock(cacheContent.blobId);
-            res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, nullptr, loadedFromCache);
+            cacheContent.blobId = measure(loadingTime, "HASH", [&] {
+                return CalculateFileHash(modelPath, parsed._deviceName, plugin, parsed._config);
+            });
+            auto lock = measure(loadingTime, "CACHE_LOCK", [&] {
+                return cacheGuard.getHashLock(cacheContent.blobId);
+            });
+            res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, nullptr, loadedFromCache, loadingTime);
             if (!loadedFromCache) {
-                auto cnnNetwork = ReadNetwork(modelPath, std::string());
+                auto cnnNetwork = readNetwork();
                 if (val) {
                     val(cnnNetwork);
                 }
-                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent);
+                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent, loadingTime);
             }
         } else if (cacheManager) {
             // TODO: 'validation' for dynamic API doesn't work for this case, as it affects a lot of plugin API
-            res = plugin.compile_model(modelPath, parsed._config);
+            res = measure(loadingTime, "COMPILE", [&] {
+                return plugin.compile_model(modelPath, parsed._config);
+            });
         } else {
-            auto cnnNetwork = ReadNetwork(modelPath, std::string());
+            auto cnnNetwork = readNetwork();
             if (val) {
                 val(cnnNetwork);
             }
-            res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent);
+            res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent, loadingTime);
         }
+        res->setLoadingTimeDetails(loadingTime);
         return {res._ptr, res._so};
     }
 
@@ -907,29 +994,40 @@ public:
             coreConfig.getCacheConfigForDevice(parsed._deviceName, DeviceSupportsCacheDir(plugin), parsed._config)
                 ._cacheManager;
         auto cacheContent = CacheContent{cacheManager};
+        LoadingTimeDetails loadingTime;
+        auto readNetwork = [&] {
+            return measure(loadingTime, "READ", [&] {
+                return ReadNetwork(modelStr, weights);
+            });
+        };
         if (cacheManager && DeviceSupportsImportExport(plugin)) {
             bool loadedFromCache = false;
             ov::Tensor tensor = ov::Tensor();
             if (weights) {
                 tensor = ov::Tensor(element::u8, {weights->byteSize()}, weights->cbuffer().as<uint8_t*>());
             }
-            cacheContent.blobId = CalculateMemoryHash(modelStr, tensor, parsed._deviceName, plugin, parsed._config);
-            auto lock = cacheGuard.getHashLock(cacheContent.blobId);
-            res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, nullptr, loadedFromCache);
+            cacheContent.blobId = measure(loadingTime, "HASH", [&] {
+                return CalculateMemoryHash(modelStr, tensor, parsed._deviceName, plugin, parsed._config);
+            });
+            auto lock = measure(loadingTime, "CACHE_LOCK", [&] {
+                return cacheGuard.getHashLock(cacheContent.blobId);
+            });
+            res = LoadNetworkFromCache(cacheContent, plugin, parsed._config, nullptr, loadedFromCache, loadingTime);
             if (!loadedFromCache) {
-                auto cnnNetwork = ReadNetwork(modelStr, weights);
+                auto cnnNetwork = readNetwork();
                 if (val) {
                     val(cnnNetwork);
                 }
-                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent);
+                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent, loadingTime);
             }
         } else {
-            auto cnnNetwork = ReadNetwork(modelStr, weights);
+            auto cnnNetwork = readNetwork();
             if (val) {
                 val(cnnNetwork);
             }
-            res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent);
+            res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, cacheContent, loadingTime);
         }
+        res->setLoadingTimeDetails(loadingTime);
         return {res._ptr, res._so};
     }
 
@@ -1074,6 +1172,8 @@ public:
         } else if (name == ov::hint::allow_auto_batching.name()) {
             const auto flag = coreConfig.flag_allow_auto_batching;
             return decltype(ov::hint::allow_auto_batching)::value_type(flag);
+        } else if (name == ov::compile_model_async_threads.name()) {
+            return decltype(ov::compile_model_async_threads)::value_type(coreConfig.compile_model_async_threads);
         }
 
         IE_THROW() << "Exception is thrown while trying to call get_property with unsupported property: '" << name
@@ -1976,6 +2076,56 @@ namespace ov {
 class Core::Impl : public CoreImpl {
 public:
     Impl() : ov::CoreImpl(true) {}
+
+    ~Impl() override {
+        // the queued compilations use the core, so they are finished before it is destroyed
+        std::lock_guard<std::mutex> lock(compileExecutorMutex);
+        compileExecutor.reset();
+        retiredCompileExecutors.clear();
+    }
+
+    /**
+     * @brief Runs the compilation on the bounded pool of ov::compile_model_async_threads threads
+     * @param compile A compilation task, it gets time the task waited in the queue in milliseconds
+     * @return A future with the compiled model
+     */
+    std::future<CompiledModel> compile_async(std::function<CompiledModel(float)> compile) {
+        const auto enqueueTime = std::chrono::steady_clock::now();
+        auto task = std::make_shared<std::packaged_task<CompiledModel()>>([compile, enqueueTime] {
+            return compile(
+                std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - enqueueTime).count());
+        });
+        auto future = task->get_future();
+        get_compile_executor()->run([task] {
+            (*task)();
+        });
+        return future;
+    }
+
+private:
+    ie::ITaskExecutor::Ptr get_compile_executor() {
+        const auto threads =
+            static_cast<int>(get_property_for_core(ov::compile_model_async_threads.name()).as<uint32_t>());
+        std::lock_guard<std::mutex> lock(compileExecutorMutex);
+        if (!compileExecutor || compileExecutorThreads != threads) {
+            // the previous executor finishes its queued compilations in the background, its threads are joined
+            // only when the core is destroyed rather than on the calling thread
+            if (compileExecutor) {
+                retiredCompileExecutors.push_back(std::move(compileExecutor));
+            }
+            // every thread compiles its own model using all the cores, so the number of threads only bounds
+            // the number of models compiled at the same time
+            compileExecutor = std::make_shared<ie::CPUStreamsExecutor>(
+                ie::IStreamsExecutor::Config{"CompileModelAsyncExecutor", threads});
+            compileExecutorThreads = threads;
+        }
+        return compileExecutor;
+    }
+
+    std::mutex compileExecutorMutex;
+    ie::IStreamsExecutor::Ptr compileExecutor;
+    std::vector<ie::IStreamsExecutor::Ptr> retiredCompileExecutors;
+    int compileExecutorThreads = 0;
 };
 
 Core::Core(const std::string& xmlConfigFile) {
@@ -2077,6 +2227,47 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
     });
 }
 
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const AnyMap& config) {
+    return compile_model_async(model, ov::DEFAULT_DEVICE_NAME, config);
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const std::string& deviceName,
+                                                     const AnyMap& config) {
+    // the core waits for the queued compilations in its destructor, so the tasks do not own it
+    auto impl = _impl.get();
+    return _impl->compile_async([=](float queueTime) -> CompiledModel {
+        OV_CORE_CALL_STATEMENT({
+            auto exec =
+                impl->LoadNetwork(toCNN(model), deviceName, any_copy(flatten_sub_properties(deviceName, config)));
+            auto loadingTime = exec->getLoadingTimeDetails();
+            loadingTime["QUEUE"] = queueTime;
+            exec->setLoadingTimeDetails(loadingTime);
+            return {exec._ptr, exec._so};
+        });
+    });
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& modelPath, const AnyMap& config) {
+    return compile_model_async(modelPath, ov::DEFAULT_DEVICE_NAME, config);
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::string& modelPath,
+                                                     const std::string& deviceName,
+                                                     const AnyMap& config) {
+    auto impl = _impl.get();
+    return _impl->compile_async([=](float queueTime) -> CompiledModel {
+        OV_CORE_CALL_STATEMENT({
+            auto exec = impl->LoadNetwork(modelPath, deviceName, any_copy(flatten_sub_properties(deviceName, config)));
+            auto loadingTime = exec->getLoadingTimeDetails();
+            loadingTime["QUEUE"] = queueTime;
+            exec->setLoadingTimeDetails(loadingTime);
+            return {exec._ptr, exec._so};
+        });
+    });
+}
+
 void Core::add_extension(const ie::IExtensionPtr& extension) {
     OV_CORE_CALL_STATEMENT(_impl->AddExtension(extension););
 }
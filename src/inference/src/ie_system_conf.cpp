@@ -33,6 +33,10 @@ bool with_cpu_x86_avx2() {
     return get_cpu_info().has(Xbyak::util::Cpu::tAVX2);
 }
 
+bool with_cpu_x86_avx2_vnni() {
+    return with_cpu_x86_avx2() && get_cpu_info().has(Xbyak::util::Cpu::tAVX_VNNI);
+}
+
 bool with_cpu_x86_avx512f() {
     return get_cpu_info().has(Xbyak::util::Cpu::tAVX512F);
 }
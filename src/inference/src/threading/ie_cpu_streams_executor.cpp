@@ -4,10 +4,13 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -27,6 +30,24 @@ using namespace openvino;
 
 namespace InferenceEngine {
 struct CPUStreamsExecutor::Impl {
+    struct QueuedTask {
+        Task _task;
+        SchedulingHint _hint;
+        std::uint64_t _sequenceNumber;
+        std::chrono::steady_clock::time_point _enqueueTime;
+    };
+    // Orders tasks by priority class, then by the earliest deadline, then by the order of enqueueing
+    struct QueuedTaskLess {
+        bool operator()(const QueuedTask& lhs, const QueuedTask& rhs) const {
+            if (lhs._hint._priority != rhs._hint._priority) {
+                return lhs._hint._priority < rhs._hint._priority;
+            }
+            if (lhs._hint._deadline != rhs._hint._deadline) {
+                return lhs._hint._deadline > rhs._hint._deadline;
+            }
+            return lhs._sequenceNumber > rhs._sequenceNumber;
+        }
+    };
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -286,8 +307,11 @@ struct CPUStreamsExecutor::Impl {
                             return !_taskQueue.empty() || (stopped = _isStopped);
                         });
                         if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                            std::pop_heap(_taskQueue.begin(), _taskQueue.end(), QueuedTaskLess{});
+                            auto& queuedTask = _taskQueue.back();
+                            task = std::move(queuedTask._task);
+                            UpdateQueueingStatistics(queuedTask);
+                            _taskQueue.pop_back();
                         }
                     }
                     if (task) {
@@ -298,14 +322,24 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, const SchedulingHint& hint = {}) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueue.push_back(QueuedTask{std::move(task), hint, _enqueuedTasks++, std::chrono::steady_clock::now()});
+            std::push_heap(_taskQueue.begin(), _taskQueue.end(), QueuedTaskLess{});
         }
         _queueCondVar.notify_one();
     }
 
+    void UpdateQueueingStatistics(const QueuedTask& queuedTask) {
+        auto delay = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                           queuedTask._enqueueTime);
+        auto& statistics = _queueingStatistics[queuedTask._hint._priority];
+        ++statistics._count;
+        statistics._total += delay;
+        statistics._max = std::max(statistics._max, delay);
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -342,7 +376,9 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    std::vector<QueuedTask> _taskQueue;  // binary heap with the most urgent task on top
+    std::uint64_t _enqueuedTasks = 0;
+    std::map<ov::hint::Priority, QueueingStatistics> _queueingStatistics;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
@@ -395,4 +431,17 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::ScheduleTask(Task task, const SchedulingHint& hint) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), hint);
+    }
+}
+
+std::map<ov::hint::Priority, IStreamsExecutor::QueueingStatistics> CPUStreamsExecutor::GetQueueingStatistics() const {
+    std::lock_guard<std::mutex> lock(_impl->_mutex);
+    return _impl->_queueingStatistics;
+}
+
 }  // namespace InferenceEngine
@@ -280,3 +280,54 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorTests, readyTasksAreOrderedByPriorityAndDeadline) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    std::promise<void> blockerStarted, releaseBlocker;
+    auto releaseFuture = releaseBlocker.get_future();
+    executor->run([&] {
+        blockerStarted.set_value();
+        releaseFuture.wait();
+    });
+    blockerStarted.get_future().wait();
+
+    std::mutex m;
+    std::vector<int> order;
+    std::vector<Future> futures;
+    auto schedule = [&](int id, ov::hint::Priority priority, std::chrono::milliseconds deadline) {
+        auto task = std::make_shared<std::packaged_task<void()>>([&, id] {
+            std::lock_guard<std::mutex> l{m};
+            order.push_back(id);
+        });
+        futures.emplace_back(task->get_future());
+        IStreamsExecutor::SchedulingHint hint;
+        hint._priority = priority;
+        if (deadline.count() != 0) {
+            hint._deadline = std::chrono::steady_clock::now() + deadline;
+        }
+        executor->ScheduleTask(
+            [task] {
+                (*task)();
+            },
+            hint);
+    };
+    const std::chrono::milliseconds noDeadline{0};
+    schedule(0, ov::hint::Priority::LOW, noDeadline);
+    schedule(1, ov::hint::Priority::MEDIUM, noDeadline);
+    schedule(2, ov::hint::Priority::MEDIUM, std::chrono::milliseconds{2000});
+    schedule(3, ov::hint::Priority::HIGH, noDeadline);
+    schedule(4, ov::hint::Priority::MEDIUM, std::chrono::milliseconds{1000});
+    schedule(5, ov::hint::Priority::MEDIUM, noDeadline);
+    releaseBlocker.set_value();
+    for (auto&& future : futures) {
+        future.wait();
+    }
+
+    ASSERT_EQ((std::vector<int>{3, 4, 2, 1, 5, 0}), order);
+    auto statistics = executor->GetQueueingStatistics();
+    ASSERT_EQ(1u, statistics[ov::hint::Priority::HIGH]._count);
+    ASSERT_EQ(5u, statistics[ov::hint::Priority::MEDIUM]._count);
+    ASSERT_EQ(1u, statistics[ov::hint::Priority::LOW]._count);
+    ASSERT_GE(statistics[ov::hint::Priority::LOW]._max, statistics[ov::hint::Priority::HIGH]._max);
+}
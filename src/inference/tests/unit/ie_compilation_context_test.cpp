@@ -15,7 +15,9 @@
 #include "ngraph/function.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/opsets/opset8.hpp"
 #include "ngraph/variant.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -380,6 +382,27 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
     ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}), NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto createNetworkWithConstant = [](size_t size, int8_t lastValue) {
+        std::vector<int8_t> values(size, 3);
+        values.back() = lastValue;
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i8, ngraph::Shape{size});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{size}, values);
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(mul);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+    };
+    // the constant is hashed by several chunks
+    const size_t size = 3 * 1024 * 1024 + 5;
+    auto net1 = createNetworkWithConstant(size, 3);
+    auto net2 = createNetworkWithConstant(size, 3);
+    auto net3 = createNetworkWithConstant(size, 4);
+    auto net4 = createNetworkWithConstant(size - 1, 3);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}), NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net2, {}), NetworkCompilationContext::computeHash(net3, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net2, {}), NetworkCompilationContext::computeHash(net4, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -407,6 +430,43 @@ TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     ASSERT_FALSE(fail);
 }
 
+// Operations with scalar int32, float and double attributes
+static std::shared_ptr<ngraph::Function> create_function_with_scalar_attributes(float grn_bias) {
+    auto data = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, 125, 13, 13});
+    auto grn = std::make_shared<ngraph::opset8::GRN>(data, grn_bias);
+    auto axes = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1});
+    auto normalize = std::make_shared<ngraph::opset8::NormalizeL2>(grn, axes, 1e-6f, ngraph::op::EpsMode::ADD);
+    auto elu = std::make_shared<ngraph::opset8::Elu>(normalize, 0.5);
+    auto region_yolo = std::make_shared<ngraph::opset8::RegionYolo>(elu, 4, 20, 5, true, std::vector<int64_t>{}, 1, 3);
+    auto res = std::make_shared<ngraph::opset8::Result>(region_yolo);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithoutSerializationForStandardOpsets) {
+    const std::vector<std::shared_ptr<ngraph::Function>> functions = {
+        create_simple_function(),
+        create_function_with_scalar_attributes(1.f),
+        ngraph::builder::subgraph::makeConvPoolRelu(),
+        ngraph::builder::subgraph::makeSplitMultiConvConcat(),
+        ngraph::builder::subgraph::makeTIwithLSTMcell(),
+        ngraph::builder::subgraph::makeDetectionOutput(),
+        ngraph::builder::subgraph::makeReadConcatSplitAssign(),
+        ngraph::builder::subgraph::makeMatMulBias(),
+    };
+    for (const auto& function : functions) {
+        EXPECT_TRUE(NetworkCompilationContext::isHashedWithoutSerialization(*function))
+            << function->get_friendly_name();
+    }
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentFloatAttributes) {
+    CNNNetwork net1(create_function_with_scalar_attributes(1.f));
+    CNNNetwork net2(create_function_with_scalar_attributes(1.f));
+    CNNNetwork net3(create_function_with_scalar_attributes(2.f));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}), NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}), NetworkCompilationContext::computeHash(net3, {}));
+}
+
 ////////////////////////////////////////////
 
 TEST(NetworkContext_ModelName, HashOfSame) {
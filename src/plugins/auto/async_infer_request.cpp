@@ -5,7 +5,24 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "async_infer_request.hpp"
 
+#include <functional>
+#include <memory>
+
 namespace MultiDevicePlugin {
+namespace {
+// passes the scheduling hint to the device request right before the wrapped executor starts it
+struct SchedulingHintExecutor : public IE::ITaskExecutor {
+    SchedulingHintExecutor(IE::ITaskExecutor::Ptr executor, std::function<void()> forwardHint)
+        : _executor(std::move(executor)), _forwardHint(std::move(forwardHint)) {}
+    void run(IE::Task task) override {
+        _forwardHint();
+        _executor->run(std::move(task));
+    }
+    IE::ITaskExecutor::Ptr _executor;
+    std::function<void()> _forwardHint;
+};
+}  // namespace
+
 AsyncInferRequest::AsyncInferRequest(const Schedule::Ptr& schedule,
     const IInferPtr& inferRequest,
     const IE::ITaskExecutor::Ptr& callbackExecutor):
@@ -15,6 +32,18 @@ AsyncInferRequest::AsyncInferRequest(const Schedule::Ptr& schedule,
     auto pipeline = _schedule->GetPipeline(_inferRequest, &_workerInferRequest);
     if (pipeline.size() > 0) {
         _pipeline = std::move(pipeline);
+        // the last stage starts the device request, either the selected worker or the shared one in the passthrough
+        auto& lastStageExecutor = _pipeline.back().first;
+        lastStageExecutor = std::make_shared<SchedulingHintExecutor>(std::move(lastStageExecutor), [this] {
+            auto& deviceRequest = nullptr != _workerInferRequest ? _workerInferRequest->_inferRequest :
+                std::static_pointer_cast<MultiDeviceInferRequest>(_inferRequest)->GetSharedRequest();
+            ForwardSchedulingHint(*deviceRequest._ptr);
+        });
+        // the device request runs the task of its stage after the inference, while the deadline of this
+        // request is checked before the first stage
+        if (_pipeline.size() == 1) {
+            _pipeline.insert(_pipeline.begin(), Stage{std::make_shared<IE::ImmediateExecutor>(), [] {}});
+        }
     }
 }
 
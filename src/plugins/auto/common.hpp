@@ -5,7 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <algorithm>
 #include <map>
+#include <mutex>
 #include <string>
 #include "ie_icore.hpp"
 #include "ie_metric_helpers.hpp"
@@ -51,6 +53,42 @@ struct DeviceInformation {
     unsigned int devicePriority;
 };
 
+// Observed service time of a device, the MULTI scheduler routes requests to the device with the earliest
+// expected completion based on it
+struct DeviceStatistics {
+    // weight of the latest sample in the exponentially weighted moving average of the latency
+    static constexpr double latencyEwmaFactor = 0.1;
+
+    void OnStart() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_inFlight;
+    }
+    void OnFinish(double latencyMs) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        --_inFlight;
+        _latencyEwma = _completed == 0 ? latencyMs
+                                       : latencyEwmaFactor * latencyMs + (1.0 - latencyEwmaFactor) * _latencyEwma;
+        ++_completed;
+    }
+    // expected completion time (ms) of a new request given the number of device worker requests,
+    // devices without samples yet report zero to get probed first
+    double ExpectedCompletion(std::size_t numWorkers) const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _latencyEwma * (_inFlight + 1) / std::max<std::size_t>(numWorkers, 1);
+    }
+    ov::AnyMap ToAnyMap() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return {{"COMPLETED", static_cast<uint64_t>(_completed)},
+                {"IN_FLIGHT", static_cast<uint64_t>(_inFlight)},
+                {"LATENCY_EWMA_MS", _latencyEwma}};
+    }
+
+    mutable std::mutex _mutex;
+    std::size_t        _completed = 0;
+    std::size_t        _inFlight = 0;
+    double             _latencyEwma = 0.0;
+};
+
 struct WorkerInferRequest {
     SoInfer            _inferRequest;
     IE::Task           _task;
@@ -58,6 +96,8 @@ struct WorkerInferRequest {
     std::list<Time>    _startTimes;
     std::list<Time>    _endTimes;
     int                _index = 0;
+    DeviceStatistics*  _statistics = nullptr;
+    Time               _dispatchTime;
 };
 
 using NotBusyPriorityWorkerRequests = IE::ThreadSafeBoundedPriorityQueue<std::pair<int, WorkerInferRequest*>>;
@@ -123,6 +163,7 @@ public:
     bool                                           _needPerfCounters;
     bool                                           _batchingDisabled = {false};
     bool                                           _bindBuffer = false;
+    DeviceMap<DeviceStatistics>                    _deviceStatistics;
     virtual ~MultiScheduleContext() = default;
 };
 
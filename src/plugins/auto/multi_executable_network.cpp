@@ -103,7 +103,8 @@ IE::Parameter MultiExecutableNetwork::GetMetric(const std::string& name) const {
             // Configs
             // device priority can be changed on-the-fly in MULTI
             ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
-            ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO}
+            ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{ov::intel_auto::device_statistics.name(), ov::PropertyMutability::RO}
         };
     } else if (name == ov::optimal_number_of_infer_requests) {
         unsigned int res = 0u;
@@ -140,6 +141,12 @@ IE::Parameter MultiExecutableNetwork::GetMetric(const std::string& name) const {
             exeDevices.push_back(n.deviceName);
         }
         return decltype(ov::available_devices)::value_type {exeDevices};
+    } else if (name == ov::intel_auto::device_statistics) {
+        ov::AnyMap statistics;
+        for (auto&& deviceStatistics : _multiSContext->_deviceStatistics) {
+            statistics[deviceStatistics.first] = deviceStatistics.second.ToAnyMap();
+        }
+        return decltype(ov::intel_auto::device_statistics)::value_type {statistics};
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric key: " << name;
     }
@@ -143,16 +143,23 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>(new IE::ThreadSafeQueue<IE::Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
     idleWorkerRequests.set_capacity(numRequests);
+    auto* statisticsPtr = &(_multiSContext->_deviceStatistics[device]);
     int num = 0;
     for (auto&& workerRequest : workerRequests) {
         workerRequest._inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
         auto* workerRequestPtr = &workerRequest;
         workerRequestPtr->_index = num++;
+        workerRequestPtr->_statistics = statisticsPtr;
         IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
         workerRequest._inferRequest->SetCallback(
             [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
                 IdleGuard<NotBusyWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                {
+                    std::chrono::duration<double, std::milli> latency =
+                        std::chrono::steady_clock::now() - workerRequestPtr->_dispatchTime;
+                    workerRequestPtr->_statistics->OnFinish(latency.count());
+                }
                 {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
@@ -178,6 +185,28 @@ bool MultiSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Dev
         std::lock_guard<std::mutex> lock(_multiSContext->_mutex);
         return _multiSContext->_devicePriorities;
     }();
+    if (preferred_device.empty() && devices.size() > 1) {
+        // try devices in order of the expected completion of the request, the priority order breaks ties
+        // (e.g. until devices have latency samples)
+        std::vector<std::pair<double, DeviceInformation>> expectedCompletions;
+        for (auto&& device : devices) {
+            double expected = 0.0;
+            auto itStatistics = _multiSContext->_deviceStatistics.find(device.deviceName);
+            auto itWorkers = _workerRequests.find(device.deviceName);
+            if (itStatistics != _multiSContext->_deviceStatistics.end() && itWorkers != _workerRequests.end()) {
+                expected = itStatistics->second.ExpectedCompletion(itWorkers->second.size());
+            }
+            expectedCompletions.emplace_back(expected, device);
+        }
+        std::stable_sort(expectedCompletions.begin(), expectedCompletions.end(),
+            [](const std::pair<double, DeviceInformation>& a, const std::pair<double, DeviceInformation>& b) {
+                return a.first < b.first;
+            });
+        devices.clear();
+        for (auto&& expectedCompletion : expectedCompletions) {
+            devices.push_back(std::move(expectedCompletion.second));
+        }
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device)) {
             continue;
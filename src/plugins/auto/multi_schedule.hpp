@@ -19,6 +19,10 @@ struct ThisRequestExecutor : public IE::ITaskExecutor {
     explicit ThisRequestExecutor(WorkerInferRequest** ptr): _workptrptr{ptr} {}
     void run(IE::Task task) override {
         (*_workptrptr)->_task = std::move(task);
+        if ((*_workptrptr)->_statistics) {
+            (*_workptrptr)->_dispatchTime = std::chrono::steady_clock::now();
+            (*_workptrptr)->_statistics->OnStart();
+        }
         (*_workptrptr)->_inferRequest->StartAsync();
     };
     WorkerInferRequest** _workptrptr = nullptr;
@@ -421,6 +421,10 @@ void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
 }
 
+void AutoBatchAsyncInferRequest::SetSchedulingHint(ov::hint::Priority, std::chrono::milliseconds, bool) {
+    IE_THROW(NotImplemented) << "Scheduling hints are not supported by the BATCH device";
+}
+
 AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
     StopAndWait();
 }
@@ -133,6 +133,8 @@ public:
                                         InferenceEngine::SoIInferRequestInternal& inferRequestWithoutBatch,
                                         const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor);
     void Infer_ThreadUnsafe() override;
+    // requests are executed as parts of batches shared with other requests, so they can't be ordered on their own
+    void SetSchedulingHint(ov::hint::Priority priority, std::chrono::milliseconds deadline, bool dropExpired) override;
     virtual ~AutoBatchAsyncInferRequest();
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
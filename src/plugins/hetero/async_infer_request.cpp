@@ -4,8 +4,12 @@
 
 #include "async_infer_request.hpp"
 
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <utility>
+#include <vector>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
@@ -15,33 +19,111 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
                                                  const ITaskExecutor::Ptr& callbackExecutor)
     : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
-    _pipeline.clear();
-    for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
-        struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
-                _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
-                    _exceptionPtr = exceptionPtr;
-                    auto capturedTask = std::move(_task);
-                    capturedTask();
+    // Sub requests are launched as a DAG: every sub request starts as soon as all sub requests producing
+    // its inputs are finished, so independent subgraphs (e.g. parallel branches on different devices) overlap
+    struct SubgraphsExecutor : ITaskExecutor {
+        SubgraphsExecutor(HeteroInferRequest::SubRequestsList& inferRequests,
+                          const std::vector<std::set<std::size_t>>& dependencies,
+                          std::function<void(IInferRequestInternal&, bool)> forwardHint)
+            : _inferRequests(inferRequests),
+              _dependencies(dependencies),
+              _forwardHint(std::move(forwardHint)),
+              _dependents(inferRequests.size()),
+              _pendingInputs(inferRequests.size()) {
+            for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                for (auto&& producerId : _dependencies[requestId]) {
+                    _dependents[producerId].push_back(requestId);
+                }
+                _inferRequests[requestId]._request->SetCallback([this, requestId](std::exception_ptr exceptionPtr) {
+                    onRequestDone(requestId, exceptionPtr);
                 });
             }
-            void run(Task task) override {
+        }
+
+        void run(Task task) override {
+            std::vector<std::size_t> readyRequests;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
                 _task = std::move(task);
-                _inferRequest->StartAsync();
-            };
-            SoIInferRequestInternal& _inferRequest;
-            std::exception_ptr _exceptionPtr;
-            Task _task;
-        };
+                _exceptionPtr = nullptr;
+                _finished = 0;
+                for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                    _pendingInputs[requestId] = _dependencies[requestId].size();
+                    if (_pendingInputs[requestId] == 0) {
+                        readyRequests.push_back(requestId);
+                    }
+                }
+                _inFlight = readyRequests.size();
+            }
+            startRequests(readyRequests, false);
+        }
 
-        auto requestExecutor =
-            std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
-        _pipeline.emplace_back(requestExecutor, [requestExecutor] {
-            if (nullptr != requestExecutor->_exceptionPtr) {
-                std::rethrow_exception(requestExecutor->_exceptionPtr);
+        void startRequests(const std::vector<std::size_t>& requestIds, bool started) {
+            for (auto&& requestId : requestIds) {
+                try {
+                    _forwardHint(*_inferRequests[requestId]._request._ptr, started);
+                    _inferRequests[requestId]._request->StartAsync();
+                } catch (...) {
+                    onRequestDone(requestId, std::current_exception());
+                }
+            }
+        }
+
+        void onRequestDone(std::size_t requestId, std::exception_ptr exceptionPtr) {
+            std::vector<std::size_t> readyRequests;
+            bool done = false;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                --_inFlight;
+                ++_finished;
+                if (nullptr != exceptionPtr && nullptr == _exceptionPtr) {
+                    _exceptionPtr = exceptionPtr;
+                }
+                // after a failure no new sub requests are started, only already running ones are awaited
+                if (nullptr == _exceptionPtr) {
+                    for (auto&& dependentId : _dependents[requestId]) {
+                        if (--_pendingInputs[dependentId] == 0) {
+                            readyRequests.push_back(dependentId);
+                        }
+                    }
+                }
+                _inFlight += readyRequests.size();
+                done = _inFlight == 0 && (nullptr != _exceptionPtr || _finished == _inferRequests.size());
             }
+            startRequests(readyRequests, true);
+            if (done) {
+                auto capturedTask = std::move(_task);
+                capturedTask();
+            }
+        }
+
+        HeteroInferRequest::SubRequestsList& _inferRequests;
+        const std::vector<std::set<std::size_t>>& _dependencies;
+        std::function<void(IInferRequestInternal&, bool)> _forwardHint;
+        std::vector<std::vector<std::size_t>> _dependents;
+        std::vector<std::size_t> _pendingInputs;
+        std::size_t _inFlight = 0;
+        std::size_t _finished = 0;
+        std::mutex _mutex;
+        std::exception_ptr _exceptionPtr;
+        Task _task;
+    };
+
+    // sub requests get the scheduling hint of the inference, only the first launched ones may drop it as expired
+    auto subgraphsExecutor = std::make_shared<SubgraphsExecutor>(
+        _heteroInferRequest->_inferRequests,
+        _heteroInferRequest->_subRequestDependencies,
+        [this](IInferRequestInternal& request, bool started) {
+            ForwardSchedulingHint(request, started);
         });
-    }
+    _pipeline.clear();
+    // sub requests run the task of the stage after the inference, while the deadline is checked before the first stage
+    _pipeline.emplace_back(std::make_shared<ImmediateExecutor>(), [] {});
+    _pipeline.emplace_back(subgraphsExecutor, [subgraphsExecutor] {
+        if (nullptr != subgraphsExecutor->_exceptionPtr) {
+            std::rethrow_exception(subgraphsExecutor->_exceptionPtr);
+        }
+    });
 }
 
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
@@ -57,6 +139,10 @@ StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     return waitStatus;
 }
 
+void HeteroAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
 InferenceEngine::Blob::Ptr HeteroAsyncInferRequest::GetBlob(const std::string& name) {
     CheckState();
     auto blob = _heteroInferRequest->GetBlob(name);
@@ -22,6 +22,10 @@ public:
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
     InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
 
+protected:
+    // Synchronous inference also goes through the DAG of subgraphs to overlap independent branches
+    void Infer_ThreadUnsafe() override;
+
 private:
     HeteroInferRequest::Ptr _heteroInferRequest;
 };
@@ -45,7 +45,11 @@ void HeteroInferRequest::CreateInferRequest(
         IE_THROW() << "Internal error: no information about network's output/input";
     }
 
-    auto requestBlob([&](const std::string& blobName, InferenceEngine::SoIInferRequestInternal& r, bool output) {
+    std::map<std::string, std::size_t> blobProducers;
+    _subRequestDependencies.assign(_inferRequests.size(), {});
+
+    auto requestBlob([&](const std::string& blobName, std::size_t requestId, bool output) {
+        auto& r = _inferRequests[requestId]._request;
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
         if (itName != subgraphInputToOutputBlobNames.end()) {
@@ -57,30 +61,33 @@ void HeteroInferRequest::CreateInferRequest(
             } else {
                 auto blob = r->GetBlob(blobName);
                 _blobs.emplace(intermediateBlobName, r->GetBlob(blobName));
+                blobProducers.emplace(intermediateBlobName, requestId);
             }
         } else {
             if (InferenceEngine::details::contains(_networkInputs, blobName)) {
                 _subRequestFromBlobName.emplace(blobName, r);
             } else {
                 r->SetBlob(blobName, _blobs.at(intermediateBlobName));
+                _subRequestDependencies[requestId].insert(blobProducers.at(intermediateBlobName));
             }
         }
     });
 
     // go over all subnet and create requests
-    for (auto&& desc : _inferRequests) {
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        auto& desc = _inferRequests[requestId];
         desc._request = {desc._network->CreateInferRequest(), desc._network._so};
         desc._request->setModelInputsOutputs(desc._network->getInputs(), desc._network->getOutputs());
         // go over all inputs and get blobs from subnet infer requests
         for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
-            requestBlob(outputInfo.first, desc._request, true);
+            requestBlob(outputInfo.first, requestId, true);
         }
     }
 
     // go over all outputs and get blobs from subnet infer requests
-    for (auto&& desc : _inferRequests) {
-        for (auto&& inputInfo : desc._network->GetInputsInfo()) {
-            requestBlob(inputInfo.first, desc._request, false);
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        for (auto&& inputInfo : _inferRequests[requestId]._network->GetInputsInfo()) {
+            requestBlob(inputInfo.first, requestId, false);
         }
     }
 }
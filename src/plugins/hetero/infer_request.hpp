@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <openvino/itt.hpp>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -57,6 +58,8 @@ public:
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
     std::map<std::string, InferenceEngine::SoIInferRequestInternal> _subRequestFromBlobName;
+    // for each sub request, the indices of sub requests which produce its intermediate inputs
+    std::vector<std::set<std::size_t>> _subRequestDependencies;
 
 private:
     void CreateInferRequest(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
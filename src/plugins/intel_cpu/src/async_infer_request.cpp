@@ -9,7 +9,20 @@ ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInfe
                                                     const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                     const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    auto request = static_cast<InferRequestBase*>(inferRequest.get());
+    request->SetAsyncRequest(this);
+
+    // Preprocessing of the request runs on its own executor, so inference streams are free to compute
+    // other requests meanwhile. Synchronous inference keeps both steps on the calling thread.
+    auto preprocessingExecutor = request->GetPreprocessingExecutor();
+    if (preprocessingExecutor) {
+        _pipeline = {{preprocessingExecutor, [request] {
+                          request->Preprocess();
+                      }},
+                     {taskExecutor, [request] {
+                          request->InferPreprocessed();
+                      }}};
+    }
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "primitive_cache_reservation.h"
+
+#include <algorithm>
+#include <mutex>
+#include <dnnl.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+struct Reservations {
+    std::mutex mutex;
+    int initialCapacity = 0;
+    int reserved = 0;
+};
+
+Reservations& reservations() {
+    static Reservations instance;
+    return instance;
+}
+
+void applyCapacity(const Reservations& state) {
+    // the capacity configured by the user is kept even if it exceeds the limit
+    const int capacity = std::max(state.initialCapacity,
+                                  std::min(state.initialCapacity + state.reserved,
+                                           PrimitiveCacheReservation::maxCapacity));
+    if (dnnl::get_primitive_cache_capacity() != capacity)
+        dnnl::set_primitive_cache_capacity(capacity);
+}
+}  // namespace
+
+constexpr int PrimitiveCacheReservation::maxCapacity;
+
+PrimitiveCacheReservation::PrimitiveCacheReservation(int primitivesNum) : _primitivesNum(std::max(primitivesNum, 0)) {
+    auto& state = reservations();
+    std::lock_guard<std::mutex> lock{state.mutex};
+    if (state.reserved == 0)
+        state.initialCapacity = dnnl::get_primitive_cache_capacity();
+    state.reserved += _primitivesNum;
+    applyCapacity(state);
+}
+
+PrimitiveCacheReservation::~PrimitiveCacheReservation() {
+    auto& state = reservations();
+    std::lock_guard<std::mutex> lock{state.mutex};
+    state.reserved -= _primitivesNum;
+    applyCapacity(state);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Reserves room for primitives in the process-wide oneDNN primitive cache while the object is alive.
+ *
+ * The capacity is the one configured before the first reservation plus the sum of the alive reservations,
+ * limited by maxCapacity. It is restored when all the reservations are released.
+ */
+class PrimitiveCacheReservation {
+public:
+    // the limit keeps the memory held by the cached primitives bounded when many models are loaded
+    static constexpr int maxCapacity = 16384;
+
+    explicit PrimitiveCacheReservation(int primitivesNum);
+    ~PrimitiveCacheReservation();
+
+    PrimitiveCacheReservation(const PrimitiveCacheReservation&) = delete;
+    PrimitiveCacheReservation& operator=(const PrimitiveCacheReservation&) = delete;
+
+private:
+    int _primitivesNum;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -103,6 +103,14 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             } else {
                 fcSparseWeiDecompressionRate = val_f;
             }
+        } else if (key == CPUConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION) {
+            if (val == PluginConfigParams::YES)
+                fcDynamicQuantization = true;
+            else if (val == PluginConfigParams::NO)
+                fcDynamicQuantization = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DYNAMIC_QUANTIZATION
+                                   << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -140,6 +148,7 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
                     enforceBF16 = true;
                     manualEnforceBF16 = true;
+                    enforceFP16Activations = false;
                 } else {
                     IE_THROW() << "Platform doesn't support BF16 format";
                 }
@@ -155,15 +164,26 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
                     enforceBF16 = true;
                     manualEnforceBF16 = true;
+                    enforceFP16Activations = false;
                 } else {
                     IE_THROW() << "Platform doesn't support BF16 format";
                 }
+            } else if (val == "f16") {
+                // FP16 <-> FP32 conversions of the activations use F16C instructions available since AVX2
+                if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+                    enforceBF16 = false;
+                    manualEnforceBF16 = false;
+                    enforceFP16Activations = true;
+                } else {
+                    IE_THROW() << "Platform doesn't support FP16 format";
+                }
             } else if (val == "f32") {
                 enforceBF16 = false;
                 manualEnforceBF16 = false;
+                enforceFP16Activations = false;
             } else {
                 IE_THROW() << "Wrong value for property key " << ov::hint::inference_precision.name()
-                    << ". Supported values: bf16, f32";
+                    << ". Supported values: bf16, f16, f32";
             }
         } else if (key == PluginConfigParams::KEY_CACHE_DIR) {
             cache_dir = val;
@@ -178,6 +198,42 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_PERF_COUNT_SAMPLING_PERIOD == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_PERF_COUNT_SAMPLING_PERIOD
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_PERF_COUNT_SAMPLING_PERIOD
+                           << ". Expected only non negative numbers";
+            perfCountSamplingPeriod = static_cast<size_t>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_PERF_TRACE_FILE == key) {
+            perfTraceFile = val;
+        } else if (PluginConfigInternalParams::KEY_CPU_PREPROCESSING_PIPELINE_DEPTH == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_PREPROCESSING_PIPELINE_DEPTH
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key "
+                           << PluginConfigInternalParams::KEY_CPU_PREPROCESSING_PIPELINE_DEPTH
+                           << ". Expected only non negative numbers";
+            preprocessingPipelineDepth = static_cast<size_t>(val_i);
+        } else if (PluginConfigInternalParams::KEY_CPU_SHARED_WEIGHTS_SEGMENT == key) {
+            if (val.find('/') != std::string::npos)
+                IE_THROW() << "Wrong value " << val << " for property key "
+                           << PluginConfigInternalParams::KEY_CPU_SHARED_WEIGHTS_SEGMENT
+                           << ". Expected a name without '/'";
+            sharedWeightsSegment = val;
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -33,11 +33,16 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    size_t perfCountSamplingPeriod = 0ul;
+    std::string perfTraceFile = "";
+    size_t preprocessingPipelineDepth = 0ul;
+    std::string sharedWeightsSegment = "";
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
+    bool fcDynamicQuantization = false;
     size_t rtCacheCapacity = 5000ul;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
@@ -50,6 +55,8 @@ struct Config {
     bool enforceBF16 = true;
     bool manualEnforceBF16 = false;
 #endif
+    // activations between bandwidth bound nodes are stored in FP16, the computations are done in FP32
+    bool enforceFP16Activations = false;
 
     std::string cache_dir{};
 
@@ -129,6 +129,9 @@ void jit_load_emitter::emit_isa(const Xbyak::Reg64 &reg_src, const int out_vec_i
             case Precision::BF16:
                 load_words_to_dword_extension<Vmm>(Vmm(out_vec_idx), reg_src, offset, true, false, load_size_);
                 break;
+            case Precision::FP16:
+                load_halfs_to_float<Vmm>(Vmm(out_vec_idx), reg_src, offset, load_size_);
+                break;
             default:
                 IE_THROW() << "Load emitter in " << name_ << " has unsupported src precision to load.";
         }
@@ -138,11 +141,11 @@ void jit_load_emitter::emit_isa(const Xbyak::Reg64 &reg_src, const int out_vec_i
     if (src_prc_ != dst_prc_) {
         switch (dst_prc_) {
             case Precision::FP32:
-                if ((src_prc_ != Precision::FP32) && (src_prc_ != Precision::BF16))
+                if (!one_of(src_prc_, Precision::FP32, Precision::BF16, Precision::FP16))
                     h->uni_vcvtdq2ps(Vmm(out_vec_idx), Vmm(out_vec_idx));
                 break;
             case Precision::I32:
-                if ((src_prc_ == Precision::FP32) || (src_prc_ == Precision::BF16)) {
+                if (one_of(src_prc_, Precision::FP32, Precision::BF16, Precision::FP16)) {
                     h->uni_vcvtps2dq(Vmm(out_vec_idx), Vmm(out_vec_idx));
                 }
                 break;
@@ -314,7 +317,8 @@ void jit_load_emitter::load_bytes(const Vmm &vmm, const Xbyak::Reg64 &reg, int o
         }
     }
 
-    if (is_fill_)
+    // halfs are filled after the conversion to floats in load_halfs_to_float
+    if (is_fill_ && !(src_prc_ == Precision::FP16 && dst_prc_ != Precision::FP16))
         fill_with_default(vmm, fill_value_, load_size / 4);
 }
 
@@ -529,6 +533,46 @@ void jit_load_emitter::load_words_to_dword_extension(const Vmm &vmm, const Xbyak
         fill_with_default(vmm, fill_value_, load_size / 2);
 }
 
+/**
+* load_halfs_to_float is the utility function to facilitate loading of
+* load_size (0 <= load_size <= 32) bytes of contiguous FP16 values from the memory
+* referenced by ptr[reg + offset] address and converting them to FP32 with F16C instructions.
+* The halfs are loaded to the lower half of the register and widened in place.
+*
+* Valid values for the load_size variable are:
+* [0..16] for YMM version of the function, i.e. 8 halfs -> 8 * 32 bit == 256 bit
+* [0..32] for ZMM version of the function, i.e. 16 halfs -> 16 * 32 bit == 512 bit
+*/
+template <typename Vmm>
+void jit_load_emitter::load_halfs_to_float(const Vmm &vmm, const Xbyak::Reg64 &reg, int offset, int load_size) const {
+    constexpr bool is_xmm = std::is_same<Vmm, Xbyak::Xmm>::value;
+    constexpr bool is_ymm = std::is_same<Vmm, Xbyak::Ymm>::value;
+    constexpr bool is_zmm = std::is_same<Vmm, Xbyak::Zmm>::value;
+
+    MAYBE_UNUSED(is_ymm);
+
+    if (is_xmm)
+        IE_THROW() << "Load emitter in " << name_ << " doesn't support FP16 load on sse41 platform.";
+    if (load_size < 0 || load_size > 32)
+        IE_THROW() << "Load emitter in " << name_ << " has unexpected number of values to load in load_halfs_to_float.";
+    if (is_ymm && load_size > 16)
+        IE_THROW() << "Load emitter in " << name_ << " has unexpected number of values to load to ymm in load_halfs_to_float.";
+
+    auto xmm = Xbyak::Xmm(vmm.getIdx());
+    auto ymm = Xbyak::Ymm(vmm.getIdx());
+
+    if (is_zmm) {
+        load_bytes(ymm, reg, offset, load_size);
+        h->vcvtph2ps(vmm, ymm);
+    } else {
+        load_bytes(xmm, reg, offset, load_size);
+        h->vcvtph2ps(vmm, xmm);
+    }
+
+    if (is_fill_)
+        fill_with_default(vmm, fill_value_, load_size / 2);
+}
+
 template <typename Vmm>
 void jit_load_emitter::fill_with_default(const Vmm &vmm, std::string fill_value, const int &load_num) const {
     constexpr bool is_xmm = std::is_same<Vmm, Xbyak::Xmm>::value;
@@ -598,7 +642,7 @@ size_t jit_store_emitter::aux_vecs_count() const {
     // to avoid src vmm pollution after data type conversion
     if ((src_prc_.is_float() && !dst_prc_.is_float()) ||
         (!src_prc_.is_float() && dst_prc_.is_float()) ||
-        (src_prc_ == Precision::FP32 && dst_prc_ == Precision::BF16))
+        (src_prc_ == Precision::FP32 && one_of(dst_prc_, Precision::BF16, Precision::FP16)))
         count++;
 
     // for data swapping to avoid using Xmm(0) as I/O xmm for jit_uni_vcvtneps2bf16
@@ -653,7 +697,7 @@ void jit_store_emitter::emit_isa(const int in_vec_idx, const Xbyak::Reg64 &reg_d
     if (src_prc_ != dst_prc_) {
         switch (src_prc_) {
             case Precision::FP32:
-                if ((dst_prc_ != Precision::FP32) && (dst_prc_ != Precision::BF16)) {
+                if (!one_of(dst_prc_, Precision::FP32, Precision::BF16, Precision::FP16)) {
                     if (is_saturation()) {
                         h->uni_vcvtps2dq(Vmm(aux_vec_idxs.back()), Vmm(data_idx));
                     } else {
@@ -663,7 +707,7 @@ void jit_store_emitter::emit_isa(const int in_vec_idx, const Xbyak::Reg64 &reg_d
                 }
                 break;
             case Precision::I32:
-                if ((dst_prc_ == Precision::FP32) || (dst_prc_ == Precision::BF16)) {
+                if (one_of(dst_prc_, Precision::FP32, Precision::BF16, Precision::FP16)) {
                     h->uni_vcvtdq2ps(Vmm(aux_vec_idxs.back()), Vmm(data_idx));
                     data_idx = aux_vec_idxs.back();
                 }
@@ -696,6 +740,9 @@ void jit_store_emitter::emit_isa(const int in_vec_idx, const Xbyak::Reg64 &reg_d
             case Precision::BF16:
                 store_dword_to_word_extension<Vmm>(Vmm(data_idx), reg_dst, offset, true, false, store_num_);
                 break;
+            case Precision::FP16:
+                store_float_to_halfs<Vmm>(Vmm(data_idx), reg_dst, offset, store_num_);
+                break;
             default:
                 IE_THROW() << "Store emitter in " << name_ << " has unsupported dst precision to store.";
         }
@@ -1182,6 +1229,44 @@ void jit_store_emitter::store_dword_to_word_extension(const Vmm &vmm, const Xbya
     }
 }
 
+/**
+* store_float_to_halfs is the utility function to
+* 1. convert store_num (0 <= store_num <= 16) floats in the Ymm/Zmm to store_num FP16 values with F16C instructions.
+* 2. store the packed halfs into the memory referenced by ptr[reg + offset] address.
+* The input register is preserved, the conversion result is kept in the auxiliary register.
+*/
+template <typename Vmm>
+void jit_store_emitter::store_float_to_halfs(const Vmm &vmm, const Xbyak::Reg64 &reg, int offset, int store_num) const {
+    constexpr bool is_xmm = std::is_same<Vmm, Xbyak::Xmm>::value;
+    constexpr bool is_ymm = std::is_same<Vmm, Xbyak::Ymm>::value;
+    constexpr bool is_zmm = std::is_same<Vmm, Xbyak::Zmm>::value;
+
+    MAYBE_UNUSED(is_ymm);
+
+    if (is_xmm)
+        IE_THROW() << "Store emitter in " << name_ << " doesn't support FP16 store on sse41 platform.";
+    if (store_num < 0 || store_num > 16)
+        IE_THROW() << "Store emitter in " << name_ << " has unexpected number of values to store in store_float_to_halfs.";
+    if (is_ymm && store_num > 8)
+        IE_THROW() << "Store emitter in " << name_ << " has unexpected number of values to store to ymm in store_float_to_halfs.";
+
+    if (store_num == (is_zmm ? 16 : 8)) {
+        h->vcvtps2ph(ptr[reg + offset], vmm, 0x4);
+        return;
+    }
+
+    const int aux_idx = static_cast<int>(aux_vec_idxs.back());
+    if (is_zmm) {
+        auto ymm = Xbyak::Ymm(aux_idx);
+        h->vcvtps2ph(ymm, vmm, 0x4);
+        store_bytes(ymm, reg, offset, store_num * 2);
+    } else {
+        auto xmm = Xbyak::Xmm(aux_idx);
+        h->vcvtps2ph(xmm, vmm, 0x4);
+        store_bytes(xmm, reg, offset, store_num * 2);
+    }
+}
+
 void jit_store_emitter::register_table_entries() {
     if (is_truncation_emulation()) {
         push_arg_entry_of("mask_truncation_byte", 0x000000ff, true);
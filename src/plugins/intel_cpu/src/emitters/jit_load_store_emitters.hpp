@@ -56,17 +56,19 @@ public:
     * fill_value: when load_num can not fully fit in vector register, what values should be filled as default values.
     *   currently support "zero", "int_one", "float_one", "int32_min", "float_min", "int32_max" and "float_max".
     * supported src_prc and dst_prc pairs are as below(x indicate for support):
-    *       FP32  I32   I16   U16   I8    U8    BF16  --> src_prc
-    * FP32   x     x     x     x     x    x     x
-    * I32    x     x     x     x     x    x     x
+    *       FP32  I32   I16   U16   I8    U8    BF16  FP16  --> src_prc
+    * FP32   x     x     x     x     x    x     x     x*
+    * I32    x     x     x     x     x    x     x     x*
     * I16                x
     * U16                      x
     * I8                             x
     * U8                                  x
     * BF16                                      x
+    * FP16                                            x
     *  |
     * \|/
     * dst_prc
+    * note: FP16-->FP32/I32(x*) is supported only on at least avx2 plateform
     */
     void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
                    const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
@@ -87,6 +89,9 @@ private:
     template <typename Vmm>
     void load_words_to_dword_extension(const Vmm &vmm, const Xbyak::Reg64 &reg, int offset, bool is_bf16, bool is_signed, int load_size) const;
 
+    template <typename Vmm>
+    void load_halfs_to_float(const Vmm &vmm, const Xbyak::Reg64 &reg, int offset, int load_size) const;
+
     template <typename Vmm>
     void fill_with_default(const Vmm &vmm, std::string fill_value, const int &load_num) const;
 
@@ -121,9 +126,11 @@ public:
     * I8     x     x                 x
     * U8     x     x                       x
     * BF16   x*    x*                             x
+    * FP16   x**   x**                                  x
     * \|/
     * dst_prc
     * note: FP32/I32-->BF16(x*) is supported only on at least avx512-core plateform
+    *       FP32/I32-->FP16(x**) is supported only on at least avx2 plateform
     */
     void emit_impl(const std::vector<size_t> &in_idxs, const std::vector<size_t> &out_idxs,
                    const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs,
@@ -150,6 +157,9 @@ private:
     template <typename Vmm>
     void store_dword_to_word_extension(const Vmm &vmm, const Xbyak::Reg64 &reg, int offset, bool is_bf16, bool is_signed, int store_size) const;
 
+    template <typename Vmm>
+    void store_float_to_halfs(const Vmm &vmm, const Xbyak::Reg64 &reg, int offset, int store_num) const;
+
     void register_table_entries() override;
 
     size_t aux_gprs_count() const override;
@@ -26,10 +26,12 @@
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
+#include "openvino/core/version.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
+#include <sstream>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -54,6 +56,46 @@ ExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs
     return std::make_shared<LegacyInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<ExecNetwork>(shared_from_this()));
 }
 
+namespace {
+/**
+ * Opens the shared memory segment of the model. The segment name includes the fingerprint of the model
+ * and of the plugin configuration, so processes attach to the same segment only if they get the same data
+ */
+SharedWeightsSegment::Ptr openSharedWeightsSegment(const std::shared_ptr<const ov::Model>& function,
+                                                   const Config& cfg) {
+    const auto& crc = WeightsSharing::GetHashFunc();
+    auto hash = [&crc](uint64_t seed, const std::string& str) {
+        return seed ^ (crc.hash(reinterpret_cast<const unsigned char*>(str.data()), str.size()) +
+                       0x9e3779b97f4a7c15 + (seed << 6) + (seed >> 2));
+    };
+
+    uint64_t fingerprint = hash(0, ov::get_openvino_version().buildNumber);
+    for (const auto& item : cfg._config)
+        fingerprint = hash(fingerprint, item.first + "=" + item.second);
+
+    size_t constantsSize = 0;
+    size_t opsNum = 0;
+    for (const auto& op : function->get_ordered_ops()) {
+        std::string desc = std::string(op->get_type_name()) + " " + op->get_friendly_name();
+        for (const auto& output : op->outputs())
+            desc += " " + output.get_element_type().get_type_name() + output.get_partial_shape().to_string();
+        fingerprint = hash(fingerprint, desc);
+        if (auto constOp = ov::as_type_ptr<ngraph::opset1::Constant>(op)) {
+            const auto size = constOp->get_byte_size();
+            fingerprint ^= crc.hash(static_cast<const unsigned char*>(constOp->get_data_ptr()), size);
+            fingerprint = hash(fingerprint, std::to_string(size));
+            constantsSize += size;
+        }
+        opsNum++;
+    }
+
+    std::stringstream name;
+    name << "/ov_cpu_" << cfg.sharedWeightsSegment << "_" << std::hex << fingerprint;
+    // repacked weights and outputs of constant subgraphs need room in addition to the constants themselves
+    return SharedWeightsSegment::open(name.str(), 2 * constantsSize + (64 << 20), 4 * opsNum + 1024);
+}
+}  // namespace
+
 struct ImmediateSerialExecutor : public ITaskExecutor {
     void run(InferenceEngine::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -119,6 +161,20 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (0 != _cfg.preprocessingPipelineDepth && !cfg.exclusiveAsyncRequests) {
+        // every stream of the executor preprocesses inputs of one request ahead of inference streams
+        _preprocessingExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUPreprocessingExecutor",
+                                     static_cast<int>(_cfg.preprocessingPipelineDepth),
+                                     1,
+                                     IStreamsExecutor::ThreadBindingType::NONE});
+    }
+    if (!_cfg.sharedWeightsSegment.empty()) {
+        // falls back to process memory if shared memory is not available
+        _numaNodesWeights = NumaNodesWeights(openSharedWeightsSegment(function, _cfg));
+    }
+    _isGraphQuantized = (_cfg.lpTransformsMode == Config::On) &&
+                        ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -128,6 +184,15 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 return graph.IsReady();
             });
         };
+        if (streams > 1) {
+            // The graph of the first stream compiles primitives, packs weights and executes constant subgraphs.
+            // Graphs of other streams take primitives from the oneDNN primitive cache and data from the weights
+            // cache, so they own only their activation memory and node state
+            _taskExecutor->runAndWait({[this] {
+                ExecNetwork::GetGraph();
+            }});
+            ReservePrimitiveCache();
+        }
         do {
             for (auto&& task : tasks) {
                 task = [this] {
@@ -164,6 +229,18 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 }
 
+void ExecNetwork::ReservePrimitiveCache() {
+    auto graph = std::find_if(_graphs.begin(), _graphs.end(), [] (const Graph& graph) {
+        return graph.IsReady();
+    });
+    if (graph == _graphs.end())
+        return;
+    // a node creates its primitive and, at most, reorders of its inputs and outputs
+    const int required = static_cast<int>(2 * graph->GetNodes().size());
+    // the capacity is global, the reservation adds room on top of it and gives it back when the network is destroyed
+    _primitiveCacheReservation.reset(new PrimitiveCacheReservation(required));
+}
+
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
@@ -182,13 +259,15 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     // disable weights caching if graph was created only once
                     auto weightsCache =
-                        _cfg.streamExecutorConfig._streams != 1 ? _numaNodesWeights[numaNodeId] : nullptr;
-
-                    auto isQuantizedFlag =
-                        (_cfg.lpTransformsMode == Config::On) &&
-                        ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
-
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantizedFlag);
+                        _cfg.streamExecutorConfig._streams != 1 || !_cfg.sharedWeightsSegment.empty()
+                            ? _numaNodesWeights[numaNodeId]
+                            : nullptr;
+
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         _mutex,
+                                                         _isGraphQuantized);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -309,6 +388,7 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
             RO_property(ov::execution_devices.name()),
+            RO_property(ov::queueing_statistics.name()),
         };
     }
 
@@ -343,7 +423,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::enable_profiling)::value_type(perfCount);
     } else if (name == ov::hint::inference_precision) {
         const auto enforceBF16 = config.enforceBF16;
-        const auto inference_precision = enforceBF16 ? ov::element::bf16 : ov::element::f32;
+        const auto inference_precision = enforceBF16 ? ov::element::bf16
+                                       : config.enforceFP16Activations ? ov::element::f16 : ov::element::f32;
         return decltype(ov::hint::inference_precision)::value_type(inference_precision);
     } else if (name == ov::hint::performance_mode) {
         const auto perfHint = ov::util::from_string(config.perfHintsConfig.ovPerfHint, ov::hint::performance_mode);
@@ -353,6 +434,22 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
     } else if (name == ov::execution_devices) {
         return decltype(ov::execution_devices)::value_type{_plugin->GetName()};
+    } else if (name == ov::queueing_statistics) {
+        ov::AnyMap queueingStatistics;
+        auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+        if (nullptr != streamsExecutor) {
+            for (const auto& classStatistics : streamsExecutor->GetQueueingStatistics()) {
+                const auto& statistics = classStatistics.second;
+                const int64_t average = statistics._count == 0
+                                            ? 0
+                                            : statistics._total.count() / static_cast<int64_t>(statistics._count);
+                queueingStatistics[ov::Any(classStatistics.first).as<std::string>()] =
+                    ov::AnyMap{{"COUNT", statistics._count},
+                               {"AVERAGE_US", average},
+                               {"MAX_US", static_cast<int64_t>(statistics._max.count())}};
+            }
+        }
+        return decltype(ov::queueing_statistics)::value_type{queueingStatistics};
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -10,6 +10,7 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include "graph_context.h"
+#include "cache/primitive_cache_reservation.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -69,6 +70,11 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // Room for the primitives of a graph in the oneDNN primitive cache, released with the network
+    std::unique_ptr<PrimitiveCacheReservation>  _primitiveCacheReservation;
+    bool                                        _isGraphQuantized = false;
+    // Runs input preprocessing of asynchronous requests concurrently with inference, nullptr if disabled
+    InferenceEngine::ITaskExecutor::Ptr         _preprocessingExecutor;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -76,6 +82,9 @@ protected:
      */
     GraphGuard::Lock GetGraph() const;
 
+    // Makes the oneDNN primitive cache hold all primitives of a graph, so graphs of other streams reuse them
+    void ReservePrimitiveCache();
+
     bool canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const;
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 
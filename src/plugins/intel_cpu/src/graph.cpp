@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <sstream>
+#include <iomanip>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -69,6 +71,13 @@ typedef std::vector<edge_cluster_t> edge_clusters_t;
 
 Graph::~Graph() {
     CPU_DEBUG_CAP_ENABLE(summary_perf(*this));
+    if (!perfTrace.empty()) {
+        try {
+            DumpPerfTrace();
+        } catch (...) {
+            // the trace is a best effort diagnostic, it must not break destruction of the graph
+        }
+    }
 }
 
 template<typename NET>
@@ -372,6 +381,10 @@ void Graph::InitGraph() {
     optimizer.ApplyCommonGraphOptimizations(*this);
     SortTopologically();
 
+    // after fusing, so the convolutions and other compute nodes keep their fused Eltwise outputs in FP32
+    if (getConfig().enforceFP16Activations)
+        EnforceFP16Activations();
+
     InitDescriptors();
 
     InitOptimalPrimitiveDescriptors();
@@ -460,6 +473,113 @@ void Graph::InitDescriptors() {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "OptimizeLayouts");
+    OptimizeLayouts();
+}
+
+void Graph::OptimizeLayouts() {
+    // Nodes select descriptors in topological order looking at parents only, so a node may choose the layout
+    // of its parent and force reorders for all its children. This pass revisits the choice of every node
+    // among descriptors of the same implementation type, which differ in layouts only, and keeps the one
+    // with the cheapest reorders around the node. The cost of a reorder is the size of the tensor it copies,
+    // reorders of constants are not counted since they are executed once.
+    auto reorderCost = [](const EdgePtr& edge, const MemoryDesc& parentDesc, const MemoryDesc& childDesc) -> size_t {
+        if (edge->getParent()->isConstant() || childDesc.isCompatible(parentDesc))
+            return 0;
+        const auto& shape = childDesc.getShape();
+        return shape.isStatic() ? std::max<size_t>(shape.getElementsCount() * childDesc.getPrecision().size(), 1) : 1;
+    };
+    auto parentDesc = [](const EdgePtr& edge) -> MemoryDescPtr {
+        auto parentSpd = edge->getParent()->getSelectedPrimitiveDescriptor();
+        if (parentSpd == nullptr || parentSpd->getConfig().outConfs.empty())
+            return nullptr;
+        int inNum = edge->getInputNum();
+        if (inNum < 0 || inNum >= parentSpd->getConfig().outConfs.size())
+            inNum = 0;
+        return parentSpd->getConfig().outConfs[inNum].getMemDesc();
+    };
+    auto childDesc = [](const EdgePtr& edge) -> MemoryDescPtr {
+        auto childSpd = edge->getChild()->getSelectedPrimitiveDescriptor();
+        const int outNum = edge->getOutputNum();
+        if (childSpd == nullptr || outNum < 0 || outNum >= childSpd->getConfig().inConfs.size())
+            return nullptr;
+        return childSpd->getConfig().inConfs[outNum].getMemDesc();
+    };
+    auto nodeCost = [&](const NodePtr& node, const NodeConfig& config) {
+        size_t cost = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            auto desc = parentDesc(edge);
+            const int port = edge->getOutputNum();
+            if (desc && port >= 0 && port < config.inConfs.size())
+                cost += reorderCost(edge, *desc, *config.inConfs[port].getMemDesc());
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            auto desc = childDesc(edge);
+            const int port = edge->getInputNum();
+            if (desc && port >= 0 && port < config.outConfs.size())
+                cost += reorderCost(edge, *config.outConfs[port].getMemDesc(), *desc);
+        }
+        return cost;
+    };
+    auto reordersCount = [&] {
+        size_t count = 0;
+        for (const auto& edge : graphEdges) {
+            auto parent = parentDesc(edge);
+            auto child = childDesc(edge);
+            if (parent && child && reorderCost(edge, *parent, *child) != 0)
+                count++;
+        }
+        return count;
+    };
+
+    const size_t reordersBefore = reordersCount();
+    // every change strictly decreases the total cost, the limit only bounds the time spent on large graphs
+    const int maxPasses = 4;
+    for (int pass = 0; pass < maxPasses; pass++) {
+        bool changed = false;
+        for (const auto& node : graphNodes) {
+            // inputs and outputs keep layouts of user memory, other nodes select descriptors by their own rules
+            if (one_of(node->getType(), Type::Input, Type::Output, Type::Convolution, Type::Concatenation, Type::Split,
+                       Type::Subgraph))
+                continue;
+            const auto& supportedPds = node->getSupportedPrimitiveDescriptors();
+            const auto selectedPd = node->getSelectedPrimitiveDescriptor();
+            if (selectedPd == nullptr || supportedPds.size() < 2)
+                continue;
+
+            const auto& selectedConfig = selectedPd->getConfig();
+            const int selected = static_cast<int>(selectedPd - supportedPds.data());
+            int best = selected;
+            size_t bestCost = nodeCost(node, selectedConfig);
+            for (size_t i = 0; i < supportedPds.size() && bestCost != 0; i++) {
+                const auto& config = supportedPds[i].getConfig();
+                if (static_cast<int>(i) == selected ||
+                    supportedPds[i].getImplementationType() != selectedPd->getImplementationType() ||
+                    config.inConfs.size() != selectedConfig.inConfs.size() ||
+                    config.outConfs.size() != selectedConfig.outConfs.size())
+                    continue;
+                const size_t cost = nodeCost(node, config);
+                if (cost < bestCost) {
+                    best = static_cast<int>(i);
+                    bestCost = cost;
+                }
+            }
+            if (best != selected) {
+                DEBUG_LOG(node->getName(), " changes descriptor ", selected, " to ", best, " to avoid reorders");
+                node->selectPrimitiveDescriptorByIndex(best);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+
+    reordersRemaining = reordersCount();
+    reordersAvoided = reordersBefore - std::min(reordersBefore, reordersRemaining);
+    DEBUG_LOG("Layout optimization avoided ", reordersAvoided, " reorders, ", reordersRemaining, " reorders remain");
 }
 
 void Graph::InitOptimalPrimitiveDescriptors() {
@@ -519,19 +639,82 @@ void Graph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // Constant nodes are split into levels: a node depends on constant nodes of previous levels only,
+    // so nodes of the same level, e.g. weights repacking of different layers, are executed concurrently
+    std::unordered_map<const Node*, size_t> nodeLevels;
+    std::vector<std::vector<NodePtr>> levels;
     for (const auto &node : constantGraphNodes) {
-        if (context->getWeightsCache()) {
-            auto sharedOutputs = acquireSharedOutputs(node);
+        size_t level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); ++i) {
+            auto found = nodeLevels.find(node->getParentEdgeAt(i)->getParent().get());
+            if (found != nodeLevels.end())
+                level = std::max(level, found->second + 1);
+        }
+        nodeLevels[node.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(node);
+    }
 
-            if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNode(node, stream);
+    for (const auto &levelNodes : levels) {
+        std::vector<NodePtr> nodesToExecute;
+        std::vector<shared_memory_ptr> sharedOutputs;
+        // outputs are locked in the same order by graphs of all streams, the first one executes the node
+        // and others wait until the data is valid
+        for (const auto &node : levelNodes) {
+            if (context->getWeightsCache()) {
+                auto nodeSharedOutputs = acquireSharedOutputs(node);
+
+                if (std::get<0>(nodeSharedOutputs) || std::get<1>(nodeSharedOutputs)) {
+                    nodesToExecute.push_back(node);
+                    auto& outputs = std::get<2>(nodeSharedOutputs);
+                    sharedOutputs.insert(sharedOutputs.end(), outputs.begin(), outputs.end());
+                }
+            } else {
+                nodesToExecute.push_back(node);
+            }
+        }
 
-                for (auto & output : std::get<2>(sharedOutputs))
-                    output->valid(true);
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        // dynamic nodes prepare parameters using the graph context caches, which are not thread safe
+        const bool parallel = nodesToExecute.size() > 1 &&
+            std::none_of(nodesToExecute.begin(), nodesToExecute.end(), [](const NodePtr& node) {
+                return node->isDynamicNode();
+            });
+        if (parallel) {
+            // nodes using the graph scratchpad would write the same buffer, they are executed one by one
+            // in a single task while the other nodes of the level run concurrently
+            std::vector<NodePtr> scratchPadNodes;
+            tbb::task_group tg;
+            for (const auto &node : nodesToExecute) {
+                if (node->usesScratchPad()) {
+                    scratchPadNodes.push_back(node);
+                    continue;
+                }
+                tg.run([this, &node] {
+                    dnnl::stream nodeStream(getEngine());
+                    ExecuteNode(node, nodeStream);
+                });
+            }
+            if (!scratchPadNodes.empty()) {
+                tg.run([this, &scratchPadNodes] {
+                    dnnl::stream nodeStream(getEngine());
+                    for (const auto &node : scratchPadNodes)
+                        ExecuteNode(node, nodeStream);
+                });
             }
+            tg.wait();
         } else {
-            ExecuteNode(node, stream);
+            for (const auto &node : nodesToExecute)
+                ExecuteNode(node, stream);
         }
+#else
+        for (const auto &node : nodesToExecute)
+            ExecuteNode(node, stream);
+#endif
+
+        for (auto & output : sharedOutputs)
+            output->valid(true);
     }
 }
 
@@ -888,7 +1071,7 @@ void Graph::CreatePrimitives() {
     }
 }
 
-void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool meanApplied) {
     if (!IsReady()) IE_THROW()<< "Wrong state. Topology not ready.";
 
     auto input = inputNodesMap.find(name);
@@ -923,7 +1106,7 @@ void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_normalizePreprocMap.find(name) != _normalizePreprocMap.end()) {
+        if (!meanApplied && _normalizePreprocMap.find(name) != _normalizePreprocMap.end()) {
             if (inTensorDesc.getPrecision() == InferenceEngine::Precision::FP32) {
                 _normalizePreprocMap[name].NormalizeImage(outDims, reinterpret_cast<float *>(inter_data_ptr),
                                                           inTensorDesc.getLayout());
@@ -1038,12 +1221,12 @@ void Graph::PullOutputData(BlobMap &out) {
     }
 }
 
-void Graph::InferStatic(InferRequestBase* request) {
+void Graph::InferStatic(InferRequestBase* request, bool collectPerfCounters) {
     dnnl::stream stream(getEngine());
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, getConfig().debugCaps.verbose);
-        PERF(node, getConfig().collectPerfCounters);
+        PERF(node, collectPerfCounters);
 
         if (request)
             request->ThrowIfCanceled();
@@ -1051,7 +1234,7 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
-void Graph::InferDynamic(InferRequestBase* request) {
+void Graph::InferDynamic(InferRequestBase* request, bool collectPerfCounters) {
     dnnl::stream stream(getEngine());
 
     std::set<size_t> syncIndsWorkSet;
@@ -1130,7 +1313,7 @@ void Graph::InferDynamic(InferRequestBase* request) {
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = executableGraphNodes[inferCounter];
             VERBOSE(node, getConfig().debugCaps.verbose);
-            PERF(node, getConfig().collectPerfCounters);
+            PERF(node, collectPerfCounters);
 
             if (request)
                 request->ThrowIfCanceled();
@@ -1157,17 +1340,78 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
+    // with sampling every N-th inference is profiled, so the statistics can stay enabled in production
+    const auto& config = getConfig();
+    const bool collectPerfCounters = config.collectPerfCounters ||
+        (config.perfCountSamplingPeriod != 0 && perfCountInferIdx++ % config.perfCountSamplingPeriod == 0);
+
     if (Status::ReadyDynamic == status) {
-        InferDynamic(request);
+        InferDynamic(request, collectPerfCounters);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        InferStatic(request, collectPerfCounters);
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
 
+    if (collectPerfCounters && !config.perfTraceFile.empty())
+        RecordPerfTrace();
+
     if (infer_count != -1) infer_count++;
 }
 
+void Graph::RecordPerfTrace() {
+    // bounds the memory consumed by the trace of a long running model
+    constexpr size_t maxPerfTraceEvents = 1 << 20;
+    if (executableGraphNodes.empty() || perfTrace.size() + executableGraphNodes.size() + 1 > maxPerfTraceEvents)
+        return;
+
+    if (perfTrace.empty()) {
+        // every graph is executed by its own stream, so graphs are shown as threads of the trace
+        static std::atomic<size_t> tracedGraphs{0};
+        perfTraceTid = tracedGraphs++;
+    }
+    const auto& first = executableGraphNodes.front()->PerfCounter();
+    const auto& last = executableGraphNodes.back()->PerfCounter();
+    perfTrace.push_back({nullptr, first.lastStart(), last.lastFinish()});
+    for (const auto& node : executableGraphNodes) {
+        const auto& counter = node->PerfCounter();
+        perfTrace.push_back({node.get(), counter.lastStart(), counter.lastFinish()});
+    }
+}
+
+void Graph::DumpPerfTrace() const {
+    auto escape = [](const std::string& str) {
+        std::string res;
+        for (const auto c : str) {
+            if (c == '"' || c == '\\')
+                res += '\\';
+            res += c;
+        }
+        return res;
+    };
+
+    std::ostringstream events;
+    events << std::fixed << std::setprecision(3);
+    const char* separator = "";
+    for (const auto& event : perfTrace) {
+        const auto ts = PerfClock::ticksToNs(event.start) / 1000;
+        const auto dur = PerfClock::ticksToNs(event.finish - event.start) / 1000;
+        events << separator << "{\"pid\": 1, \"tid\": " << perfTraceTid << ", \"ph\": \"X\", \"ts\": " << ts
+               << ", \"dur\": " << dur << ", ";
+        if (event.node) {
+            events << "\"cat\": \"node\", \"name\": \"" << escape(event.node->getName()) << "\", \"args\": {"
+                   << "\"type\": \"" << escape(event.node->getTypeStr()) << "\", \"impl\": \""
+                   << escape(event.node->getPrimitiveDescriptorType()) << "\", \"p50_us\": "
+                   << event.node->PerfCounter().percentileNs(50) / 1000 << ", \"p99_us\": "
+                   << event.node->PerfCounter().percentileNs(99) / 1000 << "}}";
+        } else {
+            events << "\"cat\": \"inference\", \"name\": \"" << escape(_name) << "\"}";
+        }
+        separator = ",\n";
+    }
+    appendPerfTrace(getConfig().perfTraceFile, events.str());
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1567,6 +1811,81 @@ void Graph::EnforceBF16() {
     }
 }
 
+// Store activations passed between bandwidth bound nodes in FP16.
+// Eltwise converts FP16 to FP32 on load and back on store and computes in FP32, Concat just copies the data.
+// Compute nodes and graph inputs / outputs keep FP32, so only the memory traffic between them is reduced.
+void Graph::EnforceFP16Activations() {
+    std::unordered_set<NodePtr> fp16Nodes;
+    for (const auto& node : graphNodes) {
+        if (!node->isConstant() && one_of(node->getType(), Type::Eltwise, Type::Concatenation))
+            fp16Nodes.insert(node);
+    }
+
+    // output precision of an Eltwise with fused nodes is defined by the last fused node
+    auto getOutputNode = [](const NodePtr& node) -> NodePtr {
+        const auto& fusedNodes = node->getFusedWith();
+        return fusedNodes.empty() ? node : fusedNodes.back();
+    };
+
+    auto isFP16Edge = [&](const EdgePtr& edge) {
+        const auto& parent = edge->getParent();
+        const auto& child = edge->getChild();
+        // inputs of the fused nodes follow the original inputs of Eltwise
+        return fp16Nodes.count(parent) && fp16Nodes.count(child) &&
+               edge->getOutputNum() < static_cast<int>(child->getOriginalInputsNumber()) &&
+               child->getOriginalInputPrecisionAtPort(edge->getOutputNum()) == Precision::FP32 &&
+               getOutputNode(parent)->getOriginalOutputPrecisionAtPort(edge->getInputNum()) == Precision::FP32;
+    };
+
+    auto isFP16Port = [&](const NodePtr& node, size_t port) {
+        const auto edges = node->getChildEdgesAtPort(port);
+        return std::all_of(edges.begin(), edges.end(), isFP16Edge);
+    };
+
+    // Concat requires equal input and output precisions, so it is kept only if all its inputs and outputs are FP16
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto it = fp16Nodes.begin(); it != fp16Nodes.end();) {
+            const auto& node = *it;
+            bool keep = true;
+            if (node->getType() == Type::Concatenation) {
+                for (size_t i = 0; i < node->getParentEdges().size() && keep; i++) {
+                    const auto edge = node->getParentEdgeAt(i);
+                    keep = isFP16Port(edge->getParent(), edge->getInputNum());
+                }
+                keep = keep && isFP16Port(node, 0);
+            }
+            if (keep) {
+                it++;
+            } else {
+                it = fp16Nodes.erase(it);
+                changed = true;
+            }
+        }
+    }
+
+    std::vector<std::pair<NodePtr, size_t>> fp16Ports;
+    for (const auto& node : graphNodes) {
+        if (!fp16Nodes.count(node))
+            continue;
+        for (size_t port = 0; port < node->getOriginalOutputsNumber(); port++) {
+            if (isFP16Port(node, port))
+                fp16Ports.emplace_back(node, port);
+        }
+    }
+
+    for (const auto& entry : fp16Ports) {
+        const auto& node = entry.first;
+        const auto port = entry.second;
+        DEBUG_LOG("#", node->getExecIndex(), " ", node->getName(), " stores output ", port, " in FP16");
+        node->setOriginalOutputPrecisionAtPort(port, Precision::FP16);
+        getOutputNode(node)->setOriginalOutputPrecisionAtPort(port, Precision::FP16);
+        for (const auto& edge : node->getChildEdgesAtPort(port))
+            edge->getChild()->setOriginalInputPrecisionAtPort(edge->getOutputNum(), Precision::FP16);
+    }
+}
+
 std::shared_ptr<ngraph::Function> Graph::dump() const {
     return dump_graph_as_ie_ngraph_net(*this);
 }
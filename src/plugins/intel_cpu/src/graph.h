@@ -58,7 +58,11 @@ public:
         return _normalizePreprocMap.find(name) != _normalizePreprocMap.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @param meanApplied mean values and scales of the input are already applied by input preprocessing,
+     * which folds them into conversion to BF16 and I8 network inputs
+     */
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool meanApplied = false);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(InferRequestBase* request = nullptr);
@@ -226,6 +230,7 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void OptimizeLayouts();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
@@ -234,8 +239,10 @@ protected:
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
-    void InferStatic(InferRequestBase* request);
-    void InferDynamic(InferRequestBase* request);
+    void InferStatic(InferRequestBase* request, bool collectPerfCounters);
+    void InferDynamic(InferRequestBase* request, bool collectPerfCounters);
+    void RecordPerfTrace();
+    void DumpPerfTrace() const;
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -255,9 +262,26 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // number of Infer() calls used to sample inferences for per node execution time statistics
+    size_t perfCountInferIdx = 0;
+
+    struct PerfTraceEvent {
+        Node* node;  // nullptr for the whole inference
+        uint64_t start;
+        uint64_t finish;
+    };
+    // node executions of profiled inferences, dumped as Chrome trace when the graph is destroyed
+    std::vector<PerfTraceEvent> perfTrace;
+    size_t perfTraceTid = 0;
+
+    // reorders estimated by OptimizeLayouts, reported in the runtime model
+    size_t reordersAvoided = 0;
+    size_t reordersRemaining = 0;
+
     GraphContext::CPtr context;
 
     void EnforceBF16();
+    void EnforceFP16Activations();
 };
 
 }   // namespace intel_cpu
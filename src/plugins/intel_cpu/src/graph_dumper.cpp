@@ -18,6 +18,8 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <iomanip>
+#include <sstream>
 
 using namespace InferenceEngine;
 
@@ -104,6 +106,16 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr &node) {
     } else {
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
+    if (node->PerfCounter().count() != 0) {
+        std::ostringstream percentiles;
+        percentiles << std::fixed << std::setprecision(3);
+        const char* separator = "";
+        for (const auto percent : {50, 90, 99}) {
+            percentiles << separator << "p" << percent << ":" << node->PerfCounter().percentileNs(percent) / 1000;
+            separator = ",";
+        }
+        serialization_info[ExecGraphInfoSerialization::PERF_COUNTER_PERCENTILES] = percentiles.str();
+    }
 
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
@@ -205,7 +217,11 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const Graph &graph
         holder->add_control_dependency(node);
     }
 
-    return std::make_shared<ngraph::Function>(results, params, graph._name);
+    auto function = std::make_shared<ngraph::Function>(results, params, graph._name);
+    // the layout optimization statistics of the graph, e.g. to check it without debug capabilities
+    function->get_rt_info()["reordersAvoided"] = std::to_string(graph.reordersAvoided);
+    function->get_rt_info()["reordersRemaining"] = std::to_string(graph.reordersRemaining);
+    return function;
 }
 
 #ifdef CPU_DEBUG_CAPS
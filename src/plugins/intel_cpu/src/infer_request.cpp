@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <chrono>
 #include <blob_factory.hpp>
 #include "nodes/concat.h"
 #include "nodes/split.h"
@@ -89,7 +90,15 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
         cpu_convert(srcData, dstData, tensorDesc.getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    // preprocessing folds mean values into BF16 and I8 inputs it writes
+    const auto info = _networkInputs.find(inputName);
+    const bool meanApplied = info != _networkInputs.end() && _preProcData.find(inputName) != _preProcData.end() &&
+                             info->second->getPreProcess().getMeanVariant() == InferenceEngine::MEAN_VALUE &&
+                             one_of(tensorDesc.getPrecision(),
+                                    InferenceEngine::Precision::I8,
+                                    InferenceEngine::Precision::BF16);
+
+    graph->PushInputData(inputName, needConvert ? iconv : inputBlob, meanApplied);
 }
 
 void InferRequestBase::PushStates() {
@@ -150,23 +159,43 @@ void InferRequestBase::redefineMemoryForInputNodes() {
 }
 
 void InferRequestBase::InferImpl() {
+    Preprocess();
+    InferPreprocessed();
+}
+
+void InferRequestBase::Preprocess() {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Preprocess");
+    const auto start = Time::now();
+
+    ThrowIfCanceled();
+    convertBatchedInputBlobs();
+    // the batch is set before preprocessing, so only the actual batch of the inputs is preprocessed,
+    // the graph nodes get it in InferPreprocessed() under the graph lock
+    if (isNewApiDynBatch()) {
+        m_curBatch = static_cast<int>(_inputs.begin()->second->getTensorDesc().getDims()[0]);
+    }
+    execDataPreprocessing(_inputs);
+
+    preprocessingFinish = Time::now();
+    preprocessingDuration = preprocessingFinish - start;
+}
+
+void InferRequestBase::InferPreprocessed() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, profilingTask);
+    const auto start = Time::now();
+    waitingDuration = start - preprocessingFinish;
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
-    convertBatchedInputBlobs();
 
     if (graph->hasDynamicInput()) {
         redefineMemoryForInputNodes();
-    } else if (graph->getConfig().isNewApi && graph->getConfig().batchLimit > 0) {
-        const auto batch = _inputs.begin()->second->getTensorDesc().getDims()[0];
-        SetBatch(batch);
+    } else if (isNewApiDynBatch()) {
+        SetBatch(m_curBatch);
     }
 
-    execDataPreprocessing(_inputs);
-
     changeDefaultPtr();
 
     ThrowIfCanceled();
@@ -186,6 +215,16 @@ void InferRequestBase::InferImpl() {
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
+
+    inferenceDuration = Time::now() - start;
+}
+
+bool InferRequestBase::isNewApiDynBatch() const {
+    return !graph->hasDynamicInput() && graph->getConfig().isNewApi && graph->getConfig().batchLimit > 0;
+}
+
+InferenceEngine::ITaskExecutor::Ptr InferRequestBase::GetPreprocessingExecutor() const {
+    return execNetwork->_preprocessingExecutor;
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
@@ -193,6 +232,22 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestB
         IE_THROW() << "Graph is not ready!";
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
     graph->GetPerfData(perfMap);
+
+    if (execNetwork->_preprocessingExecutor) {
+        // durations of the stages of the last pipelined inference
+        auto addStage = [&perfMap](const std::string& name, Time::duration duration) {
+            InferenceEngine::InferenceEngineProfileInfo info{};
+            info.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+            info.cpu_uSec = info.realTime_uSec =
+                std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+            std::string("undef").copy(info.exec_type, sizeof(info.exec_type) - 1, 0);
+            std::string("PipelineStage").copy(info.layer_type, sizeof(info.layer_type) - 1, 0);
+            perfMap[name] = info;
+        };
+        addStage("PipelineStage_Preprocessing", preprocessingDuration);
+        addStage("PipelineStage_Waiting", waitingDuration);
+        addStage("PipelineStage_Inference", inferenceDuration);
+    }
     return perfMap;
 }
 
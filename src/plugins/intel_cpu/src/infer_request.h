@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <chrono>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace ov {
@@ -22,6 +23,22 @@ public:
 
     void InferImpl() override;
 
+    /**
+     * @brief Converts batched input blobs and runs legacy input preprocessing. Doesn't modify the graph, so
+     * it can run on a separate executor while the stream infers other requests
+     */
+    void Preprocess();
+
+    /**
+     * @brief Infers inputs prepared by Preprocess()
+     */
+    void InferPreprocessed();
+
+    /**
+     * @brief Returns the executor of the preprocessing stage of asynchronous requests, nullptr if it is disabled
+     */
+    InferenceEngine::ITaskExecutor::Ptr GetPreprocessingExecutor() const;
+
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
@@ -62,12 +79,20 @@ private:
     void PushStates();
     void PullStates();
     void redefineMemoryForInputNodes();
+    // the batch of the inputs is set to the static graph of the new API model with a dynamic batch
+    bool isNewApiDynBatch() const;
 
     void changeDefaultPtr();
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
+
+    using Time = std::chrono::steady_clock;
+    Time::time_point                    preprocessingFinish;
+    Time::duration                      preprocessingDuration = {};
+    Time::duration                      waitingDuration = {};
+    Time::duration                      inferenceDuration = {};
 };
 
 class LegacyInferRequest : public InferRequestBase {
@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_horizontal_fusion.hpp"
+#include "op/fully_connected.hpp"
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "transformations/utils/utils.hpp"
+
+#include "itt.hpp"
+
+namespace {
+// FullyConnected with constant floating point weights [O, I] and optional constant bias
+bool isFusable(const std::shared_ptr<ov::intel_cpu::FullyConnectedNode>& fc) {
+    const auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc->get_input_node_shared_ptr(1));
+    if (!weights || weights->get_shape().size() != 2 || !weights->get_element_type().is_real() ||
+        weights->get_element_type() != fc->get_input_element_type(0))
+        return false;
+    if (fc->get_input_size() == 3 && !ngraph::is_type<ngraph::opset1::Constant>(fc->get_input_node_ptr(2)))
+        return false;
+    // the node is already replaced by the fusion of its siblings
+    if (fc->output(0).get_target_inputs().empty())
+        return false;
+    // Consumers of the fused node are separated by the Split, so they are not fused into it as post ops.
+    // A FakeQuantize post op makes the node write quantized output, so such nodes are left untouched.
+    // Other Eltwise post ops run as separate nodes on the Split views: one more pass over the output of
+    // the branch, which costs less than reading the activations once per branch.
+    for (const auto& input : fc->output(0).get_target_inputs()) {
+        if (ngraph::is_type<ngraph::opset1::FakeQuantize>(input.get_node()))
+            return false;
+    }
+    return fc->get_output_partial_shape(0).rank().is_static();
+}
+
+bool areFusable(const std::shared_ptr<ov::intel_cpu::FullyConnectedNode>& lhs,
+                const std::shared_ptr<ov::intel_cpu::FullyConnectedNode>& rhs) {
+    return lhs->get_input_size() == rhs->get_input_size() &&
+           lhs->get_input_shape(1)[1] == rhs->get_input_shape(1)[1] &&
+           lhs->get_input_element_type(1) == rhs->get_input_element_type(1) &&
+           (lhs->get_input_size() == 2 || lhs->get_input_element_type(2) == rhs->get_input_element_type(2)) &&
+           lhs->get_output_rank() == rhs->get_output_rank() &&
+           lhs->get_output_element_type(0) == rhs->get_output_element_type(0);
+}
+}  // namespace
+
+ov::intel_cpu::FullyConnectedHorizontalFusion::FullyConnectedHorizontalFusion() {
+    MATCHER_SCOPE(FullyConnectedHorizontalFusion);
+    auto m_fc = ngraph::pattern::wrap_type<ov::intel_cpu::FullyConnectedNode>();
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto fc = std::dynamic_pointer_cast<ov::intel_cpu::FullyConnectedNode>(m.get_match_root());
+        if (!fc || transformation_callback(fc) || !isFusable(fc)) {
+            return false;
+        }
+
+        std::vector<std::shared_ptr<ov::intel_cpu::FullyConnectedNode>> siblings;
+        for (const auto& input : fc->input_value(0).get_target_inputs()) {
+            auto node = input.get_node()->shared_from_this();
+            auto sibling = std::dynamic_pointer_cast<ov::intel_cpu::FullyConnectedNode>(node);
+            if (sibling && input.get_index() == 0 && !transformation_callback(sibling) &&
+                isFusable(sibling) && areFusable(fc, sibling)) {
+                siblings.push_back(sibling);
+            }
+        }
+        if (siblings.size() < 2) {
+            return false;
+        }
+        // keep the order of the nodes in the model, so the fused weights don't depend on the set ordering
+        std::sort(siblings.begin(), siblings.end(), [](const std::shared_ptr<ngraph::Node>& lhs,
+                                                      const std::shared_ptr<ngraph::Node>& rhs) {
+            return lhs->get_instance_id() < rhs->get_instance_id();
+        });
+
+        ngraph::NodeVector new_ops;
+        ngraph::OutputVector weights, biases;
+        std::vector<int64_t> split_lengths;
+        for (const auto& sibling : siblings) {
+            weights.push_back(sibling->input_value(1));
+            if (sibling->get_input_size() == 3) {
+                biases.push_back(sibling->input_value(2));
+            }
+            split_lengths.push_back(static_cast<int64_t>(sibling->get_input_shape(1)[0]));
+        }
+
+        auto fused_weights = ngraph::op::util::make_try_fold<ngraph::opset1::Concat>(weights, 0);
+        new_ops.push_back(fused_weights);
+        std::shared_ptr<ov::intel_cpu::FullyConnectedNode> fused_fc;
+        if (biases.empty()) {
+            fused_fc = std::make_shared<ov::intel_cpu::FullyConnectedNode>(fc->input_value(0),
+                                                                           fused_weights,
+                                                                           fc->get_output_rank(),
+                                                                           fc->get_output_type());
+        } else {
+            auto fused_bias = ngraph::op::util::make_try_fold<ngraph::opset1::Concat>(biases, 0);
+            new_ops.push_back(fused_bias);
+            fused_fc = std::make_shared<ov::intel_cpu::FullyConnectedNode>(fc->input_value(0),
+                                                                           fused_weights,
+                                                                           fused_bias,
+                                                                           fc->get_output_rank(),
+                                                                           fc->get_output_type());
+        }
+        new_ops.push_back(fused_fc);
+
+        const auto axis = fused_fc->get_output_partial_shape(0).rank().get_length() - 1;
+        auto split = std::make_shared<ngraph::opset1::VariadicSplit>(
+            fused_fc,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, {axis}),
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{split_lengths.size()}, split_lengths));
+        new_ops.push_back(split);
+
+        ngraph::NodeVector old_ops(siblings.begin(), siblings.end());
+        fused_fc->set_friendly_name(siblings.front()->get_friendly_name() + "/horizontal_fusion");
+        split->set_friendly_name(siblings.front()->get_friendly_name() + "/horizontal_fusion/split");
+        ngraph::copy_runtime_info(old_ops, new_ops);
+        for (size_t i = 0; i < siblings.size(); i++) {
+            siblings[i]->output(0).replace(split->output(i));
+        }
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_fc, matcher_name);
+    this->register_matcher(m, callback);
+}
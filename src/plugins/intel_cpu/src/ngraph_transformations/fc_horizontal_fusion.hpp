@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Replaces FullyConnected nodes reading the same activations with one FullyConnected on concatenated weights
+ *     (and biases) followed by VariadicSplit on the last axis, e.g. Q, K and V projections of attention.
+ *     Activations are read once by a single larger GEMM, and the Split outputs are in-place views of its output.
+ *     FullyConnected nodes followed by FakeQuantize are not fused, as the Split prevents the FakeQuantize post op.
+ *
+ * Before:
+ *
+ *              +--------+
+ *              | Input  |
+ *              +--------+
+ *              /        \
+ *   +-------------+  +-------------+
+ *   | FC(W1, B1)  |  | FC(W2, B2)  |
+ *   +-------------+  +-------------+
+ *
+ * After:
+ *
+ *              +--------+
+ *              | Input  |
+ *              +--------+
+ *                  |
+ *   +-----------------------------------+
+ *   | FC(Concat(W1, W2), Concat(B1, B2)) |
+ *   +-----------------------------------+
+ *                  |
+ *          +---------------+
+ *          | VariadicSplit |
+ *          +---------------+
+ *              /        \
+ */
+class FullyConnectedHorizontalFusion : public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FullyConnectedHorizontalFusion", "0");
+    FullyConnectedHorizontalFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -534,6 +534,11 @@ public:
         return isDynamic;
     }
 
+    // the scratchpad memory is shared by all nodes of the graph, so such nodes must not be executed concurrently
+    bool usesScratchPad() const {
+        return scratchpadMem != nullptr;
+    }
+
     const Shape& getInputShapeAtPort(size_t port) const {
         if (inputShapes.size() <= port) {
             IE_THROW() << "Incorrect input port number for node " << getName();
@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_quantization.h"
+
+#include <algorithm>
+#include <cmath>
+#include "ie_parallel.hpp"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr float maxQuantized = 127.f;
+
+// returns the scale of the row and its reciprocal, the scale of a zero row is 1 to keep dequantization finite
+inline float rowScale(const float* src, size_t cols, float& invScale) {
+    float absMax = 0.f;
+    for (size_t i = 0; i < cols; i++)
+        absMax = std::max(absMax, std::abs(src[i]));
+    const float scale = absMax > 0.f ? absMax / maxQuantized : 1.f;
+    invScale = 1.f / scale;
+    return scale;
+}
+
+inline int quantize(float value, float invScale) {
+    const float q = std::nearbyint(value * invScale);
+    return static_cast<int>(std::min(std::max(q, -maxQuantized), maxQuantized));
+}
+}  // namespace
+
+void quantizeActivationsPerRow(const float* src, size_t rows, size_t cols, uint8_t* dst, float* scales) {
+    parallel_for(rows, [&](size_t row) {
+        const float* srcRow = src + row * cols;
+        uint8_t* dstRow = dst + row * cols;
+        float invScale;
+        scales[row] = rowScale(srcRow, cols, invScale);
+        for (size_t i = 0; i < cols; i++)
+            dstRow[i] = static_cast<uint8_t>(quantize(srcRow[i], invScale) + 128);
+    });
+}
+
+void quantizeWeightsPerRow(const float* src, size_t rows, size_t cols, int8_t* dst, float* scales) {
+    parallel_for(rows, [&](size_t row) {
+        const float* srcRow = src + row * cols;
+        int8_t* dstRow = dst + row * cols;
+        float invScale;
+        scales[row] = rowScale(srcRow, cols, invScale);
+        for (size_t i = 0; i < cols; i++)
+            dstRow[i] = static_cast<int8_t>(quantize(srcRow[i], invScale));
+    });
+}
+
+void dequantizeAccumulators(const int32_t* acc, size_t rows, size_t cols, const float* srcScales,
+                            const float* weiScales, const float* bias, float* dst) {
+    parallel_for(rows, [&](size_t row) {
+        const int32_t* accRow = acc + row * cols;
+        float* dstRow = dst + row * cols;
+        const float srcScale = srcScales[row];
+        if (bias) {
+            for (size_t i = 0; i < cols; i++)
+                dstRow[i] = static_cast<float>(accRow[i]) * srcScale * weiScales[i] + bias[i];
+        } else {
+            for (size_t i = 0; i < cols; i++)
+                dstRow[i] = static_cast<float>(accRow[i]) * srcScale * weiScales[i];
+        }
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
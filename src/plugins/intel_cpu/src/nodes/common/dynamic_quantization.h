@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Symmetric INT8 quantization of FP32 matrices done at runtime, so INT8 GEMM can be used without calibration.
+ * Every row gets its own scale max(|x|) / 127, i.e. activations are quantized per token and weights per output channel.
+ */
+
+/**
+ * Quantizes every row of the [rows, cols] activations. Quantized values are stored shifted by 128 as U8,
+ * so they are multiplied by S8 weights with u8s8s32 GEMM using 128 as zero point of the activations.
+ */
+void quantizeActivationsPerRow(const float* src, size_t rows, size_t cols, uint8_t* dst, float* scales);
+
+/**
+ * Quantizes every row of the [rows, cols] weights to S8
+ */
+void quantizeWeightsPerRow(const float* src, size_t rows, size_t cols, int8_t* dst, float* scales);
+
+/**
+ * Rescales INT32 accumulators of the quantized GEMM back to FP32:
+ * dst[m, n] = acc[m, n] * srcScales[m] * weiScales[n] + bias[n], bias may be nullptr
+ */
+void dequantizeAccumulators(const int32_t* acc, size_t rows, size_t cols, const float* srcScales,
+                            const float* weiScales, const float* bias, float* dst);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -4,6 +4,7 @@
 
 #include "concat.h"
 
+#include <algorithm>
 #include <map>
 #include <utility>
 #include <vector>
@@ -87,11 +88,13 @@ void Concat::getSupportedDescriptors() {
     }
 
     // we need the first dims before axis to be 1 to avoid the reorder in the edge between the first parent and this concat
+    // otherwise the inputs are strided views of the output in the plain layout
     // TODO [DS]: inplace
     if (!isDynamicNode()) {
         const auto& childDims = outputShapes[0].getStaticDims();
-        if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
-            canBeInPlace = true;
+        canBeInPlace = true;
+        inPlaceStrided = !std::all_of(childDims.begin(), childDims.begin() + axis,
+                                      [](size_t dim) { return  dim == 1; });
     }
 }
 
@@ -190,6 +193,9 @@ void Concat::initSupportedPrimitiveDescriptors() {
         auto config = refConfig;
 
         auto denseOutDesc = refConfig.outConfs[0].getMemDesc()->as<CpuBlockedMemoryDesc>();
+        // strided views are described for the plain layout only
+        if (inPlaceStrided && !denseOutDesc->hasLayoutType(LayoutType::ncsp))
+            continue;
         const auto &order = denseOutDesc->getOrder();
         const auto &blkDims = denseOutDesc->getBlockDims();
         auto numOfDim = blkDims.size();
@@ -201,10 +207,11 @@ void Concat::initSupportedPrimitiveDescriptors() {
         BlockedMemoryDesc::CmpMask mask = BLOCKED_DESC_SKIP_OFFSET_MASK; // any offset
 
         for (size_t i = 2; i <= numOfDim; i++) {
-            if (numOfDim - i < axis) {
+            if (numOfDim - i < axis && !inPlaceStrided) {
                 strides[numOfDim - i] = Shape::UNDEFINED_DIM;
                 mask.reset(numOfDim - i); // any strides on certain axis
             } else {
+                // dims before axis of a strided view have strides of the output
                 strides[numOfDim - i] = strides[numOfDim - i + 1] * blkDims[numOfDim - i + 1];
             }
         }
@@ -234,6 +241,9 @@ void Concat::selectOptimalPrimitiveDescriptor() {
         }
     }
 
+    if (canBeInPlace && inPlaceStrided && !canParentsWriteStridedViews())
+        canBeInPlace = false;
+
     std::map<LayoutType, size_t> formatFrequency;
     std::vector<LayoutType> supportedLayouts = {LayoutType::ncsp, LayoutType::nspc, LayoutType::nCsp8c, LayoutType::nCsp16c};
     for (size_t i = 0; i < getParentEdges().size(); i++) {
@@ -338,6 +348,34 @@ void Concat::selectOptimalPrimitiveDescriptor() {
     selectPrimitiveDescriptorByIndex(0);
 }
 
+bool Concat::canParentsWriteStridedViews() const {
+    auto inPlacePd = std::find_if(supportedPrimitiveDescriptors.begin(), supportedPrimitiveDescriptors.end(),
+                                  [](const NodeDesc& pd) {
+                                      return pd.getImplementationType() == impl_desc_type::unknown;
+                                  });
+    if (inPlacePd == supportedPrimitiveDescriptors.end())
+        return false;
+
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto parentEdge = getParentEdgeAt(i);
+        auto parent = parentEdge->getParent();
+        auto parentPd = parent->getSelectedPrimitiveDescriptor();
+        const int outputIndex = parentEdge->getInputNum();
+        if (parentPd == nullptr || outputIndex < 0 ||
+            outputIndex >= static_cast<int>(parentPd->getConfig().outConfs.size()))
+            return false;
+
+        // Only MatMul writes the strided view itself efficiently: other primitives may fall back to slow
+        // implementations for strided outputs, and a parent producing a dense tensor would need a reorder
+        // copying the data as the out of place concat does
+        const auto& parentPortDesc = parentPd->getConfig().outConfs[outputIndex].getPortDesc();
+        const auto& inPlacePortDesc = inPlacePd->getConfig().inConfs[i].getPortDesc();
+        if (parent->getType() != Type::MatMul || !parentPortDesc->isCompatible(*inPlacePortDesc))
+            return false;
+    }
+    return true;
+}
+
 bool Concat::created() const {
     return getType() == Type::Concatenation;
 }
@@ -38,7 +38,9 @@ private:
     size_t axis = 0;
     size_t reorderedAxis = 0;
     bool canBeInPlace = false;
+    bool inPlaceStrided = false;  // in-place inputs are strided views of the output since dims before axis are not 1
     bool canOptimizeNspc = false;
+    bool canParentsWriteStridedViews() const;
     void execRef();
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
     void execNspcSpecCase();
@@ -656,6 +656,11 @@ private:
         }
     }
 
+    // FP16 and BF16 values are converted to FP32 on load and back on store, the computations are done in FP32
+    static bool isFloatPrecision(Precision prc) {
+        return one_of(prc, Precision::FP32, Precision::BF16, Precision::FP16);
+    }
+
     inline void load_vector(Vmm vmm_src, const Xbyak::Address &op, Precision src_prc, Precision dst_prc, bool broadcast) {
         Xmm xmm_src = Xmm(vmm_src.getIdx());
 
@@ -672,6 +677,9 @@ private:
                     vpmovzxwd(vmm_src, op);
                     uni_vpslld(vmm_src, vmm_src, 16);
                     break;
+                case Precision::FP16:
+                    vcvtph2ps(vmm_src, op);
+                    break;
                 case Precision::U16:
                     uni_vpmovzxwd(vmm_src, op);
                     break;
@@ -690,11 +698,11 @@ private:
 
             switch (dst_prc) {
                 case Precision::FP32:
-                    if (src_prc != Precision::FP32 && src_prc != Precision::BF16)
+                    if (!isFloatPrecision(src_prc))
                         uni_vcvtdq2ps(vmm_src, vmm_src);
                     break;
                 case Precision::I32:
-                    if (src_prc == Precision::FP32 || src_prc == Precision::BF16)
+                    if (isFloatPrecision(src_prc))
                         uni_vcvtps2dq(vmm_src, vmm_src);
                     break;
                 default:
@@ -713,6 +721,10 @@ private:
                 uni_vpinsrw(xmm_src, xmm_src, op, 0);
                 uni_vpslld(xmm_src, xmm_src, 16);
                 break;
+            case Precision::FP16:
+                uni_vpinsrw(xmm_src, xmm_src, op, 0);
+                vcvtph2ps(xmm_src, xmm_src);
+                break;
             case Precision::I16:
                 uni_vpinsrw(xmm_src, xmm_src, op, 0);
                 uni_vpmovsxwd(xmm_src, op);
@@ -735,11 +747,11 @@ private:
 
         switch (dst_prc) {
             case Precision::FP32:
-                if (src_prc != Precision::FP32 && src_prc != Precision::BF16)
+                if (!isFloatPrecision(src_prc))
                     uni_vcvtdq2ps(xmm_src, xmm_src);
                 break;
             case Precision::I32:
-                if (src_prc == Precision::FP32 || src_prc == Precision::BF16)
+                if (isFloatPrecision(src_prc))
                     uni_vcvtps2dq(xmm_src, xmm_src);
                 break;
             default:
@@ -753,11 +765,11 @@ private:
 
         switch (src_prc) {
             case Precision::FP32:
-                if (dst_prc != Precision::FP32 && dst_prc != Precision::BF16)
+                if (!isFloatPrecision(dst_prc))
                     uni_vcvtps2dq(vmm_dst, vmm_dst);
                 break;
             case Precision::I32:
-                if (dst_prc == Precision::FP32 || dst_prc == Precision::BF16)
+                if (isFloatPrecision(dst_prc))
                     uni_vcvtdq2ps(vmm_dst, vmm_dst);
                 break;
             default:
@@ -773,6 +785,9 @@ private:
                 uni_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm_dst.getIdx())}, {static_cast<size_t>(ymm_dst.getIdx())});
                 vmovdqu16(op, ymm_dst);
                 break;
+            case Precision::FP16:
+                vcvtps2ph(op, vmm_dst, 0x4);
+                break;
             case Precision::I16:
                 if (isa == x64::avx512_core) {
                     vpmovsdw(op, vmm_dst);
@@ -837,11 +852,11 @@ private:
     inline void store_scalar(const Xbyak::Address &op, Xmm xmm_dst, Precision src_prc, Precision dst_prc) {
         switch (src_prc) {
             case Precision::FP32:
-                if (dst_prc != Precision::FP32 && dst_prc != Precision::BF16)
+                if (!isFloatPrecision(dst_prc))
                     uni_vcvtps2dq(xmm_dst, xmm_dst);
                 break;
             case Precision::I32:
-                if (dst_prc == Precision::FP32 || dst_prc == Precision::BF16)
+                if (isFloatPrecision(dst_prc))
                     uni_vcvtdq2ps(xmm_dst, xmm_dst);
                 break;
             default:
@@ -857,6 +872,10 @@ private:
                 uni_vpsrld(xmm_dst, xmm_dst, 16);
                 uni_vpextrw(op, xmm_dst, 0x0);
                 break;
+            case Precision::FP16:
+                vcvtps2ph(xmm_dst, xmm_dst, 0x4);
+                uni_vpextrw(op, xmm_dst, 0x0);
+                break;
             case Precision::I16:
                 uni_vpackssdw(xmm_dst, xmm_dst, xmm_dst);
                 movq(reg_tmp_64, xmm_dst);
@@ -1757,6 +1776,9 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
             Precision::BF16,
             Precision::I32
     };
+    // F16C conversions are available on every AVX2 capable target
+    if (mayiuse(x64::avx2))
+        supportedPrecisions.push_back(Precision::FP16);
 
     if (!supportedPrimitiveDescriptors.empty())
         return;
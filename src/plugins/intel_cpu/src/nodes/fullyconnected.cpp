@@ -8,8 +8,11 @@
 #include "fake_quantize.h"
 #include "input.h"
 #include "reorder.h"
+#include "common/dynamic_quantization.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -171,6 +174,12 @@ VectorDims FullyConnected::makeDummyOutputDims(const VectorDims& inDims) const {
     return shapeInferGeneric(inShapes).front();
 }
 
+void FullyConnected::init() {
+    // decided once before fusing, so canFuse and the descriptors of the node agree on it, the oneDNN descriptors
+    // are still created to select FP32 layouts of the activations
+    useDynamicQuantization = canUseDynamicQuantization();
+}
+
 void FullyConnected::getSupportedDescriptors() {
     if (getParentEdges().size() != 2 && getParentEdges().size() != 3)
         IE_THROW() << errorPrefix << " has incorrect number of input edges";
@@ -232,6 +241,12 @@ void FullyConnected::prepareParams() {
             IE_THROW() << "Input memory hasn't been allocated.";
     }
 
+    if (useDynamicQuantization) {
+        if (!dynQuantWeights)
+            prepareDynamicQuantizedWeights();
+        return;
+    }
+
     NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
@@ -425,6 +440,11 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useDynamicQuantization) {
+        executeDynamicQuantized();
+        return;
+    }
+
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -454,6 +474,9 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // post ops are not applied to the output of the dynamically quantized GEMM
+    if (useDynamicQuantization)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -713,6 +736,9 @@ std::shared_ptr<MemoryDesc> FullyConnected::getDstMemDesc(dnnl::primitive_desc_i
 }
 
 InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
+    if (useDynamicQuantization)
+        return Precision::I8;
+
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
     size_t inputsNumLimit = 2;
@@ -885,7 +911,7 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
         if (weightCache != nullptr) {
             const std::string string_hash = getName() + "_" + format
                                             + "_" + std::to_string(blob->GetSize())
-                                            + "_" + std::to_string(reinterpret_cast<uint64_t>(blob->GetData()));
+                                            + "_" + weightCache->dataKey(blob->GetData(), blob->GetSize());
 
             ptr = *weightCache->findOrCreate(string_hash, create);
         } else {
@@ -897,6 +923,82 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     return ptr;
 }
 
+bool FullyConnected::canUseDynamicQuantization() const {
+    const auto& config = context->getConfig();
+    if (!config.fcDynamicQuantization || config.enableDynamicBatch)
+        return false;
+    // INT8 GEMM outperforms FP32 one only with VNNI instructions
+    if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_vnni) &&
+        !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2_vnni))
+        return false;
+
+    // FP32 data and weights also exclude the sparse weights decompression working with INT8 ones
+    return one_of(getInputShapeAtPort(DATA_ID).getRank(), 2, 3) &&
+           getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant() &&
+           getOriginalInputPrecisionAtPort(DATA_ID) == Precision::FP32 &&
+           getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::FP32 &&
+           getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+}
+
+void FullyConnected::prepareDynamicQuantizedWeights() {
+    auto blob = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!blob)
+        IE_THROW() << "Cannot get const weights blob for node " << getName() << ".";
+    const auto& weightsDims = blob->getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+
+    auto create = [&] () {
+        const VectorDims dims{OC * sizeof(float) + OC * IC};
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+        _ptr->Create(std::make_shared<CpuBlockedMemoryDesc>(Precision::U8, Shape(dims)));
+        auto scales = static_cast<float*>(_ptr->GetData());
+        auto weights = reinterpret_cast<int8_t*>(scales + OC);
+        quantizeWeightsPerRow(static_cast<const float*>(blob->GetData()), OC, IC, weights, scales);
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_dynamic_quantization_" + std::to_string(blob->GetSize())
+                                        + "_" + weightCache->dataKey(blob->GetData(), blob->GetSize());
+        dynQuantWeights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        dynQuantWeights = create();
+    }
+}
+
+void FullyConnected::executeDynamicQuantized() {
+    const auto& srcMem = getParentEdgesAtPort(DATA_ID)[0]->getMemory();
+    const auto& dstMem = getChildEdgesAtPort(0)[0]->getMemory();
+    const auto& srcDims = srcMem.getStaticDims();
+    const size_t K = srcDims.back();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    const size_t N = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory().getStaticDims()[0];
+
+    dynQuantSrc.resize(M * K);
+    dynQuantSrcScales.resize(M);
+    dynQuantAcc.resize(M * N);
+
+    quantizeActivationsPerRow(reinterpret_cast<const float*>(srcMem.GetPtr()), M, K, dynQuantSrc.data(),
+                              dynQuantSrcScales.data());
+
+    // acc = (src - 128) * weights^T, the weights are [OC, IC]
+    const auto weiScales = static_cast<const float*>(dynQuantWeights->GetData());
+    const auto weights = reinterpret_cast<const int8_t*>(weiScales + N);
+    const int32_t accOffset = 0;
+    const auto status = dnnl::gemm_u8s8s32('N', 'T', 'F', M, N, K, 1.f, dynQuantSrc.data(), K, 128, weights, K, 0, 0.f,
+                                           dynQuantAcc.data(), N, &accOffset);
+    if (status != dnnl::status::success)
+        IE_THROW() << errorPrefix << " failed to execute INT8 GEMM";
+
+    const float* bias = nullptr;
+    if (withBiases)
+        bias = reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemory().GetPtr());
+    dequantizeAccumulators(dynQuantAcc.data(), M, N, dynQuantSrcScales.data(), weiScales, bias,
+                           reinterpret_cast<float*>(dstMem.GetPtr()));
+}
+
 bool FullyConnected::useSparseWeightsDecompression() {
     // minSparseRate == 1 means that sparse feature is switched off
     if (minSparseRate == 1.f) {
@@ -20,6 +20,7 @@ public:
     FullyConnected(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
 
     std::vector<dnnl::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
+    void init() override;
     void getSupportedDescriptors() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
@@ -114,6 +115,17 @@ private:
     float minSparseRate = 1.f;
     float weiSparseRate = 0.f;
     bool useSparseWeightsDecompression();
+
+    // FP32 activations quantized to INT8 per row at runtime, see nodes/common/dynamic_quantization.h
+    bool useDynamicQuantization = false;
+    // scales of the output channels followed by the INT8 weights
+    MemoryPtr dynQuantWeights;
+    std::vector<uint8_t> dynQuantSrc;
+    std::vector<float> dynQuantSrcScales;
+    std::vector<int32_t> dynQuantAcc;
+    bool canUseDynamicQuantization() const;
+    void prepareDynamicQuantizedWeights();
+    void executeDynamicQuantized();
 };
 
 }   // namespace node
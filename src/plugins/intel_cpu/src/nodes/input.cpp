@@ -343,15 +343,14 @@ void Input::cloneBlobIfRequired() {
         return false;
     };
 
+    auto weightCache = context->getWeightsCache();
+
     auto blobKey = [&, this] () {
-        char ptr[32];
-        snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
         return getName()
                 + "_" + std::to_string(size * prec.size())
-                + "_" + ptr;
+                + "_" + weightCache->constDataKey(constOp->get_data_ptr(), size * prec.size());
     };
 
-    auto weightCache = context->getWeightsCache();
     if (weightCache) {
         MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
         memoryPtr = std::const_pointer_cast<const Memory>(ptr);
@@ -21,6 +21,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include <dnnl_extension_utils.h>
 #include <common/primitive_hashing_utils.hpp>
+#include "utils/debug_capabilities.h"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -238,6 +239,36 @@ static VectorDims getStridesAndModifyShape(Shape& shape, const bool transpose) {
     return strides;
 }
 
+/* Activations may be strided views of larger tensors, e.g. in-place Split outputs or in-place Concat inputs.
+ * oneDNN matmul reads and writes plain tensors with arbitrary outer strides, so the inner stride only is required
+ * to be dense and the offset may be any.
+ */
+static BlockedMemoryDesc::CmpMask getStridedViewMask(const size_t rank) {
+    BlockedMemoryDesc::CmpMask mask = BLOCKED_DESC_SKIP_OFFSET_MASK;
+    for (size_t i = 0; i + 1 < rank; i++)
+        mask.reset(i);
+    return mask;
+}
+
+// Describes the input memory with its own strides and offset, transposed the same way as getStridesAndModifyShape does
+static DnnlMemoryDescPtr getStridedViewDesc(const MemoryPtr& memPtr, const bool transpose) {
+    auto desc = memPtr->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+    const int rank = desc.data.ndims;
+    if (transpose && rank > 1) {
+        std::vector<int> permutation(rank);
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::swap(permutation[rank - 2], permutation[rank - 1]);
+        desc = desc.permute_axes(permutation);
+    }
+    return DnnlExtensionUtils::makeDescriptor(desc);
+}
+
+static bool isDenseMemory(const MemoryPtr& memPtr) {
+    const auto desc = memPtr->GetDescWithType<BlockedMemoryDesc>();
+    return desc->getOffsetPadding() == 0 &&
+           desc->getStrides() == CpuBlockedMemoryDesc(desc->getPrecision(), desc->getShape()).getStrides();
+}
+
 dnnl::memory::desc MatMul::getBiasDescFrom(const DnnlMemoryDescCPtr outMemDesc) {
     // oneDNN matmul requires shape for bias desc to be the same rank
     VectorDims biasDims(outMemDesc->getShape().getRank(), 1);
@@ -434,7 +465,13 @@ void MatMul::initSupportedPrimitiveDescriptors() {
                 PortConfig portConfig;
                 portConfig.inPlace(-1);
                 portConfig.constant(false);
-                portConfig.setMemDesc(getSrcMemDesc(itpd, i));
+                auto desc = getSrcMemDesc(itpd, i);
+                if (!isDynamicNode() && i < 2 && !getParentEdgeAt(i)->getParent()->isConstant()) {
+                    portConfig.setMemDesc(std::dynamic_pointer_cast<BlockedMemoryDesc>(desc),
+                                          getStridedViewMask(desc->getShape().getRank()));
+                } else {
+                    portConfig.setMemDesc(desc);
+                }
 
                 config.inConfs.push_back(portConfig);
             }
@@ -443,7 +480,13 @@ void MatMul::initSupportedPrimitiveDescriptors() {
                 PortConfig portConfig;
                 portConfig.inPlace(canBeInPlace() ? 0 : -1);
                 portConfig.constant(false);
-                portConfig.setMemDesc(getDstMemDesc(itpd, i));
+                auto desc = getDstMemDesc(itpd, i);
+                auto blockedDesc = std::dynamic_pointer_cast<BlockedMemoryDesc>(desc);
+                if (!isDynamicNode() && blockedDesc && blockedDesc->hasLayoutType(LayoutType::ncsp)) {
+                    portConfig.setMemDesc(blockedDesc, getStridedViewMask(desc->getShape().getRank()));
+                } else {
+                    portConfig.setMemDesc(desc);
+                }
 
                 config.outConfs.push_back(portConfig);
             }
@@ -515,8 +558,8 @@ void MatMul::prepareParams() {
         src1TransposedDesc = std::make_shared<DnnlBlockedMemoryDesc>(src1Desc.getPrecision(), src1Shape, src1Strides);
     } else {
         attr = initPrimitiveAttr();
-        src0TransposedDesc = inDataDesc[0];
-        src1TransposedDesc = inDataDesc[1];
+        src0TransposedDesc = isDenseMemory(src0MemPtr) ? inDataDesc[0] : getStridedViewDesc(src0MemPtr, transposeIn[0]);
+        src1TransposedDesc = isDenseMemory(src1MemPtr) ? inDataDesc[1] : getStridedViewDesc(src1MemPtr, transposeIn[1]);
     }
 
     auto dstDnnlDesc = dstMemPtr->GetDescWithType<DnnlMemoryDesc>();
@@ -550,17 +593,26 @@ void MatMul::prepareParams() {
 
         DnnlDesriptor desc(matmul_desc);
         primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(engine, key.attr);
-        matmul::primitive_desc prim_desc;
+        if (!static_cast<bool>(itpd))
+            return nullptr;
+        // the selected implementation may not support strided views, the best one of the others is used then
+        matmul::primitive_desc prim_desc = itpd.get();
 
+        bool found = false;
         while (static_cast<bool>(itpd))  {
             impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
             if (impl_type == key.implType) {
                 prim_desc = itpd.get();
+                found = true;
                 break;
             }
             if (!itpd.next_impl())
-                return nullptr;
+                break;
+        }
+        if (!found) {
+            DEBUG_LOG("MatMul implementation ", impl_type_to_string(key.implType),
+                      " doesn't support the strided views, falls back to ", prim_desc.impl_info_str());
         }
         return std::make_shared<matmul>(prim_desc);
     };
@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <numeric>
+
+#include <ie_common.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+# ifndef _WIN32
+#  include <cpuid.h>
+# endif
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+bool PerfClock::hasInvariantTsc() {
+#if defined(__x86_64__) || defined(_M_X64)
+    unsigned int regs[4] = {};
+# ifdef _WIN32
+    __cpuid(reinterpret_cast<int*>(regs), 0x80000000);
+# else
+    __get_cpuid(0x80000000, &regs[0], &regs[1], &regs[2], &regs[3]);
+# endif
+    if (regs[0] < 0x80000007)
+        return false;
+# ifdef _WIN32
+    __cpuid(reinterpret_cast<int*>(regs), 0x80000007);
+# else
+    __get_cpuid(0x80000007, &regs[0], &regs[1], &regs[2], &regs[3]);
+# endif
+    // EDX bit 8: TSC runs at a constant rate in all ACPI P-, C- and T-states
+    return (regs[3] & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+double PerfClock::nsPerTick() {
+    static const double ratio = [] {
+        if (!useTsc())
+            return 1.0;
+        // calibrate the time stamp counter against steady_clock once
+        const auto steadyStart = std::chrono::steady_clock::now();
+        const uint64_t ticksStart = now();
+        std::chrono::steady_clock::duration elapsed;
+        do {
+            elapsed = std::chrono::steady_clock::now() - steadyStart;
+        } while (elapsed < std::chrono::milliseconds(10));
+        const uint64_t ticks = now() - ticksStart;
+        return ticks == 0 ? 1.0
+                          : std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() /
+                                static_cast<double>(ticks);
+    }();
+    return ratio;
+}
+
+double PerfHistogram::lowerBound(int idx) {
+    if (idx < subBuckets)
+        return idx;
+    const int log = idx / subBuckets + subBucketsLog - 1;
+    return std::ldexp(subBuckets + idx % subBuckets, log - subBucketsLog);
+}
+
+double PerfHistogram::percentile(double percent) const {
+    const uint64_t total = std::accumulate(buckets.begin(), buckets.end(), uint64_t(0));
+    if (total == 0)
+        return 0;
+    const auto rank = static_cast<uint64_t>(std::ceil(percent / 100.0 * total));
+    uint64_t seen = 0;
+    for (int i = 0; i < bucketsNum; i++) {
+        seen += buckets[i];
+        if (seen >= rank && buckets[i] != 0) {
+            // the middle of the bucket
+            return PerfClock::ticksToNs(static_cast<uint64_t>((lowerBound(i) + lowerBound(i + 1)) / 2));
+        }
+    }
+    return PerfClock::ticksToNs(static_cast<uint64_t>(lowerBound(bucketsNum - 1)));
+}
+
+void appendPerfTrace(const std::string& file, const std::string& events) {
+    static const std::string header = "{\"traceEvents\": [\n";
+    static const std::string footer = "\n]}\n";
+    static std::mutex mutex;
+    // files written by the process and whether they have events, the events themselves are kept in the files only
+    static std::map<std::string, bool> files;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = files.find(file);
+    if (it == files.end()) {
+        std::ofstream stream(file, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!stream.is_open())
+            IE_THROW() << "CPU plugin cannot open performance trace file " << file;
+        stream << header << events << footer;
+        files.emplace(file, !events.empty());
+        return;
+    }
+    if (events.empty())
+        return;
+
+    // overwrite the footer, so the file stays a valid JSON after every call
+    std::fstream stream(file, std::ios::in | std::ios::out | std::ios::binary);
+    if (!stream.is_open())
+        IE_THROW() << "CPU plugin cannot open performance trace file " << file;
+    stream.seekp(0, std::ios::end);
+    const auto size = static_cast<std::streamoff>(stream.tellp());
+    if (size < static_cast<std::streamoff>(header.size() + footer.size()))
+        IE_THROW() << "CPU plugin performance trace file " << file << " is truncated";
+    stream.seekp(size - static_cast<std::streamoff>(footer.size()));
+    if (it->second)
+        stream << ",\n";
+    stream << events << footer;
+    it->second = true;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -4,54 +4,167 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <ratio>
+#include <string>
+
+#if defined(__x86_64__) || defined(_M_X64)
+# ifdef _WIN32
+#  include <intrin.h>
+# else
+#  include <x86intrin.h>
+# endif
+#endif
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Cheap monotonic clock for per node profiling.
+ * Reads the invariant time stamp counter on x86-64 and falls back to std::chrono::steady_clock otherwise,
+ * ticks are converted to nanoseconds only when statistics are read.
+ */
+class PerfClock {
+public:
+    static uint64_t now() {
+#if defined(__x86_64__) || defined(_M_X64)
+        if (useTsc())
+            return __rdtsc();
+#endif
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static double ticksToNs(uint64_t ticks) { return ticks * nsPerTick(); }
+
+private:
+    static bool useTsc() {
+        static const bool invariantTsc = hasInvariantTsc();
+        return invariantTsc;
+    }
+    static bool hasInvariantTsc();
+    static double nsPerTick();
+};
+
+/**
+ * @brief Log-linear histogram of durations in clock ticks.
+ * Each power of two range is split into 16 buckets, so percentiles have relative error within about 3%.
+ */
+class PerfHistogram {
+public:
+    void add(uint64_t ticks) { buckets[index(ticks)]++; }
+
+    /**
+     * @brief Returns the duration in nanoseconds below which the given percent of recorded durations lie
+     */
+    double percentile(double percent) const;
+
+private:
+    static constexpr int subBucketsLog = 4;
+    static constexpr int subBuckets = 1 << subBucketsLog;
+    static constexpr int maxLog = 47;
+    static constexpr int bucketsNum = (maxLog - subBucketsLog + 2) * subBuckets;
+
+    static int index(uint64_t ticks) {
+        if (ticks < subBuckets)
+            return static_cast<int>(ticks);
+        int log = 63 - countLeadingZeros(ticks);
+        if (log > maxLog)
+            return bucketsNum - 1;
+        const auto subBucket = static_cast<int>((ticks >> (log - subBucketsLog)) & (subBuckets - 1));
+        return (log - subBucketsLog + 1) * subBuckets + subBucket;
+    }
+
+    static int countLeadingZeros(uint64_t value) {
+#ifdef _MSC_VER
+        unsigned long idx;
+        _BitScanReverse64(&idx, value);
+        return 63 - static_cast<int>(idx);
+#else
+        return __builtin_clzll(value);
+#endif
+    }
+
+    static double lowerBound(int idx);
+
+    std::array<uint32_t, bucketsNum> buckets = {};
+};
+
+/**
+ * @brief Per node execution time statistics.
+ * Every graph is executed by a single stream at a time, so counters are updated without synchronization.
+ */
 class PerfCount {
     uint64_t total_duration;
     uint32_t num;
 
-    std::chrono::high_resolution_clock::time_point __start = {};
-    std::chrono::high_resolution_clock::time_point __finish = {};
+    uint64_t __start = 0;
+    uint64_t __finish = 0;
+    std::unique_ptr<PerfHistogram> histogram;
 
 public:
     PerfCount(): total_duration(0), num(0) {}
 
     std::chrono::duration<double, std::milli> duration() const {
-        return __finish - __start;
+        return std::chrono::duration<double, std::nano>(PerfClock::ticksToNs(__finish - __start));
     }
 
-    uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
+    uint64_t avg() const { return (num == 0) ? 0 : static_cast<uint64_t>(avgNs() / 1000); }
+    double avgNs() const { return (num == 0) ? 0 : PerfClock::ticksToNs(total_duration) / num; }
     uint32_t count() const { return num; }
 
+    /**
+     * @brief Returns the duration in nanoseconds below which the given percent of node executions lie
+     */
+    double percentileNs(double percent) const { return histogram ? histogram->percentile(percent) : 0; }
+
+    // clock ticks of the last execution, see PerfClock
+    uint64_t lastStart() const { return __start; }
+    uint64_t lastFinish() const { return __finish; }
+
 private:
     void start_itr() {
-        __start = std::chrono::high_resolution_clock::now();
+        __start = PerfClock::now();
     }
 
     void finish_itr() {
-        __finish = std::chrono::high_resolution_clock::now();
-        total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        __finish = PerfClock::now();
+        const uint64_t ticks = __finish - __start;
+        total_duration += ticks;
         num++;
+        if (!histogram)
+            histogram.reset(new PerfHistogram());
+        histogram->add(ticks);
     }
 
     friend class PerfHelper;
 };
 
+/**
+ * @brief Appends Chrome trace events (comma separated JSON objects) to the trace file.
+ * The file is truncated on the first call in the process, later calls write only the new events
+ */
+void appendPerfTrace(const std::string& file, const std::string& events);
+
 class PerfHelper {
-    PerfCount &counter;
+    PerfCount* counter;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    PerfHelper(PerfCount &count, bool need): counter(need ? &count : nullptr) {
+        if (counter)
+            counter->start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        if (counter)
+            counter->finish_itr();
+    }
 };
 
 }   // namespace intel_cpu
 }   // namespace ov
 
-#define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
-#define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
+#define PERF(_node, _need) PerfHelper pc(_node->PerfCounter(), _need);
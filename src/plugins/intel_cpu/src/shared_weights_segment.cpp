@@ -0,0 +1,230 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_weights_segment.h"
+#include "weights_cache.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#ifdef __linux__
+# include <cerrno>
+# include <fcntl.h>
+# include <signal.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+              "Atomics placed in shared memory must be lock free");
+
+namespace {
+constexpr uint64_t segmentMagic = 0x4f56435055534857;  // "OVCPUSHW"
+constexpr size_t blockAlignment = 64;
+
+// entries without a key have zero hash and the Free state
+enum EntryState : uint32_t {
+    Free = 0,
+    Writing = 1,
+    Ready = 2,
+};
+
+size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// second hash of the key, the entry matches the key only if both hashes match
+uint64_t fnv1a(const std::string& key) {
+    uint64_t hash = 0xcbf29ce484222325;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+}  // namespace
+
+struct SharedWeightsSegment::Header {
+    uint64_t magic;         // written by the creator when the segment is initialized
+    uint64_t entriesNum;
+    uint64_t dataOffset;
+    uint64_t dataSize;
+    std::atomic<uint64_t> used;
+    std::atomic<uint32_t> initialized;
+};
+
+struct SharedWeightsSegment::Entry {
+    std::atomic<uint32_t> state;
+    std::atomic<int32_t> owner;     // pid of the writing process
+    std::atomic<uint64_t> hash;
+    std::atomic<uint64_t> check;
+    uint64_t offset;
+    uint64_t size;
+};
+
+bool SharedWeightsSegment::Block::isReady() const {
+    return _entry && _entry->state.load(std::memory_order_acquire) == Ready;
+}
+
+void SharedWeightsSegment::Block::publish() {
+    if (_entry)
+        _entry->state.store(Ready, std::memory_order_release);
+}
+
+#ifdef __linux__
+
+SharedWeightsSegment::Ptr SharedWeightsSegment::open(const std::string& name, size_t dataSize, size_t entriesNum) {
+    const size_t dataOffset = alignUp(sizeof(Header) + entriesNum * sizeof(Entry), blockAlignment);
+    const size_t size = dataOffset + alignUp(dataSize, blockAlignment);
+
+    bool created = true;
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0 && errno == EEXIST) {
+        created = false;
+        fd = shm_open(name.c_str(), O_RDWR, 0600);
+    }
+    if (fd < 0)
+        return nullptr;
+
+    if (created) {
+        if (ftruncate(fd, size) != 0) {
+            close(fd);
+            shm_unlink(name.c_str());
+            return nullptr;
+        }
+    } else {
+        // the creator may still be sizing the segment
+        struct stat st = {};
+        for (int i = 0; i < 1000 && fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) < size; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (static_cast<size_t>(st.st_size) != size) {
+            close(fd);
+            return nullptr;
+        }
+    }
+
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+
+    auto header = static_cast<Header*>(base);
+    if (created) {
+        header->entriesNum = entriesNum;
+        header->dataOffset = dataOffset;
+        header->dataSize = size - dataOffset;
+        header->used.store(0, std::memory_order_relaxed);
+        header->magic = segmentMagic;
+        header->initialized.store(1, std::memory_order_release);
+    } else {
+        for (int i = 0; i < 1000 && header->initialized.load(std::memory_order_acquire) == 0; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (header->initialized.load(std::memory_order_acquire) == 0 || header->magic != segmentMagic ||
+            header->entriesNum != entriesNum || header->dataOffset != dataOffset) {
+            munmap(base, size);
+            close(fd);
+            return nullptr;
+        }
+    }
+
+    return Ptr(new SharedWeightsSegment(name, fd, base, size));
+}
+
+SharedWeightsSegment::~SharedWeightsSegment() {
+    munmap(_base, _size);
+    close(_fd);
+}
+
+void* SharedWeightsSegment::allocate(size_t size) {
+    auto header = static_cast<Header*>(_base);
+    const size_t alignedSize = alignUp(size, blockAlignment);
+    // the space is reserved only if the block fits, so a big block doesn't exhaust the segment for smaller ones
+    uint64_t offset = header->used.load(std::memory_order_relaxed);
+    do {
+        if (offset + alignedSize > header->dataSize)
+            return nullptr;
+    } while (!header->used.compare_exchange_weak(offset, offset + alignedSize, std::memory_order_relaxed));
+    // back the block with memory now, so running out of shared memory is an error here and not a SIGBUS later
+    if (posix_fallocate(_fd, header->dataOffset + offset, alignedSize) != 0)
+        return nullptr;
+    return static_cast<uint8_t*>(_base) + header->dataOffset + offset;
+}
+
+SharedWeightsSegment::Block SharedWeightsSegment::acquire(const std::string& key, size_t size) {
+    auto header = static_cast<Header*>(_base);
+    auto entries = reinterpret_cast<Entry*>(header + 1);
+    auto dataBegin = static_cast<uint8_t*>(_base) + header->dataOffset;
+
+    uint64_t hash = WeightsSharing::GetHashFunc().hash(reinterpret_cast<const unsigned char*>(key.data()), key.size());
+    hash = hash ? hash : 1;  // zero marks an entry without a key yet
+    const uint64_t check = fnv1a(key);
+
+    const size_t entriesNum = header->entriesNum;
+    for (size_t i = 0, idx = hash % entriesNum; i < entriesNum; i++, idx = (idx + 1) % entriesNum) {
+        Entry& entry = entries[idx];
+        // the key is claimed by publishing its hash into a free entry, so two processes can't claim it twice
+        uint64_t entryHash = 0;
+        if (entry.hash.compare_exchange_strong(entryHash, hash, std::memory_order_acq_rel)) {
+            void* data = allocate(size);
+            entry.owner.store(getpid(), std::memory_order_relaxed);
+            entry.check.store(check, std::memory_order_relaxed);
+            entry.offset = data ? static_cast<uint8_t*>(data) - dataBegin : 0;
+            entry.size = data ? size : 0;
+            // the segment is full, the entry is published empty so nobody waits for it or takes it over
+            entry.state.store(data ? Writing : Ready, std::memory_order_release);
+            return data ? Block(data, &entry) : Block();
+        }
+        if (entryHash != hash)
+            continue;
+
+        // the entry fields are visible once the claiming process moves it out of the Free state
+        const uint32_t state = entry.state.load(std::memory_order_acquire);
+        if (state == Free)
+            return {};
+        if (entry.check.load(std::memory_order_relaxed) != check)
+            continue;
+        if (entry.size != size)
+            return {};
+        if (state == Ready)
+            return Block(dataBegin + entry.offset, &entry);
+
+        // take over the entry if its writer died before publishing the data
+        int32_t owner = entry.owner.load(std::memory_order_relaxed);
+        if (owner != getpid() && kill(owner, 0) != 0 && errno == ESRCH &&
+            entry.owner.compare_exchange_strong(owner, getpid(), std::memory_order_acq_rel))
+            return Block(dataBegin + entry.offset, &entry);
+        return {};
+    }
+    return {};
+}
+
+#else
+
+SharedWeightsSegment::Ptr SharedWeightsSegment::open(const std::string&, size_t, size_t) {
+    return nullptr;
+}
+
+SharedWeightsSegment::~SharedWeightsSegment() = default;
+
+void* SharedWeightsSegment::allocate(size_t) {
+    return nullptr;
+}
+
+SharedWeightsSegment::Block SharedWeightsSegment::acquire(const std::string&, size_t) {
+    return {};
+}
+
+#endif
+
+SharedWeightsSegment::SharedWeightsSegment(std::string name, int fd, void* base, size_t size)
+    : _name(std::move(name)), _fd(fd), _base(base), _size(size) {}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Named POSIX shared memory segment keeping immutable data of a compiled model: constants, repacked weights
+ * and outputs of constant subgraphs. Every process compiling or importing the same model with the same
+ * segment name attaches to the segment and maps the data published by other processes instead of keeping
+ * its own copy.
+ *
+ * The segment is never removed by the plugin, so restarted processes find the data ready.
+ * Is a thread and process safe.
+ */
+class SharedWeightsSegment {
+    struct Header;
+    struct Entry;
+
+public:
+    typedef std::shared_ptr<SharedWeightsSegment> Ptr;
+
+    /**
+     * Block of the segment reserved for a key
+     */
+    class Block {
+    public:
+        Block() = default;
+
+        void* data() const { return _data; }
+        explicit operator bool() const { return _data != nullptr; }
+
+        /**
+         * @return true if the data was written and published by this or another process
+         */
+        bool isReady() const;
+
+        /**
+         * Makes the written data visible to other processes
+         */
+        void publish();
+
+    private:
+        friend class SharedWeightsSegment;
+        Block(void* data, Entry* entry) : _data(data), _entry(entry) {}
+
+        void* _data = nullptr;
+        Entry* _entry = nullptr;
+    };
+
+    /**
+     * Creates the segment or attaches to the one created by another process
+     * @param name name of the segment, must start with '/'
+     * @param dataSize capacity of the data area in bytes
+     * @param entriesNum capacity of the index
+     * @return nullptr if shared memory is not available
+     */
+    static Ptr open(const std::string& name, size_t dataSize, size_t entriesNum);
+
+    ~SharedWeightsSegment();
+
+    /**
+     * Returns the block of the key: published one, or a newly reserved one the caller must fill and publish.
+     * Returns an empty block if another process is writing the data of the key right now or the segment is full,
+     * the caller then keeps the data in process memory.
+     */
+    Block acquire(const std::string& key, size_t size);
+
+    const std::string& name() const { return _name; }
+
+private:
+    SharedWeightsSegment(std::string name, int fd, void* base, size_t size);
+
+    void* allocate(size_t size);
+
+    std::string _name;
+    int _fd = -1;
+    void* _base = nullptr;
+    size_t _size = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -3,6 +3,7 @@
 //
 
 #include "jit_kernel.hpp"
+#include <openvino/core/type/float16.hpp>
 #include <stdexcept>
 #include <iostream>
 #include <cstring>
@@ -138,6 +139,11 @@ InferenceEngine::Precision type2precision<bfloat16_t>() {
     return InferenceEngine::Precision::BF16;
 }
 
+template<>
+InferenceEngine::Precision type2precision<ov::float16>() {
+    return InferenceEngine::Precision::FP16;
+}
+
 template<>
 InferenceEngine::Precision type2precision<uint8_t>() {
     return InferenceEngine::Precision::U8;
@@ -4,12 +4,123 @@
 
 #include "weights_cache.hpp"
 
+#include "nodes/common/cpu_memcpy.h"
+#include "ie_parallel.hpp"
+
 #include <ie_system_conf.h>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+# include <nmmintrin.h>
+#endif
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+constexpr uint32_t crc32cPoly = 0x82f63b78;  // reflected Castagnoli polynomial
+
+inline uint64_t load64(const unsigned char* data) {
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+// murmur3 finalizer, spreads the CRC bits over the whole 64-bit value
+inline uint64_t mix64(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53;
+    h ^= h >> 33;
+    return h;
+}
+
+inline uint64_t finalize(const uint32_t (&crc)[4], size_t size) {
+    const uint64_t lo = (static_cast<uint64_t>(crc[0]) << 32) | crc[1];
+    const uint64_t hi = (static_cast<uint64_t>(crc[2]) << 32) | crc[3];
+    return mix64(lo ^ mix64(hi ^ size));
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+# if defined(__GNUC__) || defined(__clang__)
+__attribute__((target("sse4.2")))
+# endif
+uint64_t hashCrcInstruction(const unsigned char* data, size_t size) {
+    uint64_t crc[4] = {0, 1, 2, 3};
+    size_t i = 0;
+    // independent lanes hide the 3 cycles latency of crc32
+    for (; i + 32 <= size; i += 32) {
+        crc[0] = _mm_crc32_u64(crc[0], load64(data + i));
+        crc[1] = _mm_crc32_u64(crc[1], load64(data + i + 8));
+        crc[2] = _mm_crc32_u64(crc[2], load64(data + i + 16));
+        crc[3] = _mm_crc32_u64(crc[3], load64(data + i + 24));
+    }
+    for (; i + 8 <= size; i += 8)
+        crc[0] = _mm_crc32_u64(crc[0], load64(data + i));
+    for (; i < size; i++)
+        crc[0] = _mm_crc32_u8(static_cast<uint32_t>(crc[0]), data[i]);
+
+    const uint32_t lanes[4] = {static_cast<uint32_t>(crc[0]), static_cast<uint32_t>(crc[1]),
+                               static_cast<uint32_t>(crc[2]), static_cast<uint32_t>(crc[3])};
+    return finalize(lanes, size);
+}
+#endif
+}  // namespace
+
+SimpleDataHash::SimpleDataHash() {
+    for (int i = 0; i < kTableSize; i++) {
+        uint32_t c = i;
+        for (int j = 0; j < 8; j++)
+            c = ((c & 1) ? crc32cPoly : 0) ^ (c >> 1);
+        table[i] = c;
+    }
+#if defined(__x86_64__) || defined(_M_X64)
+    useCrcInstruction = InferenceEngine::with_cpu_x86_sse42();
+#endif
+}
+
+uint64_t SimpleDataHash::hashChunk(const unsigned char* data, size_t size) const {
+#if defined(__x86_64__) || defined(_M_X64)
+    if (useCrcInstruction)
+        return hashCrcInstruction(data, size);
+#endif
+    // table driven equivalent of the crc32 instruction
+    auto update = [this](uint32_t crc, const unsigned char* bytes, size_t n) {
+        for (size_t i = 0; i < n; i++)
+            crc = table[(crc ^ bytes[i]) & 0xff] ^ (crc >> 8);
+        return crc;
+    };
+    uint32_t crc[4] = {0, 1, 2, 3};
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        for (int lane = 0; lane < 4; lane++)
+            crc[lane] = update(crc[lane], data + i + 8 * lane, 8);
+    }
+    crc[0] = update(crc[0], data + i, size - i);
+    return finalize(crc, size);
+}
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kChunkSize)
+        return hashChunk(data, size);
+
+    // chunk boundaries don't depend on the number of threads, so the result doesn't either
+    const size_t chunkSize = kChunkSize;
+    const size_t chunksNum = (size + chunkSize - 1) / chunkSize;
+    std::vector<uint64_t> chunkHashes(chunksNum);
+    InferenceEngine::parallel_for(chunksNum, [&](size_t i) {
+        const size_t offset = i * chunkSize;
+        chunkHashes[i] = hashChunk(data + offset, std::min(chunkSize, size - offset));
+    });
+    return hashChunk(reinterpret_cast<const unsigned char*>(chunkHashes.data()), chunksNum * sizeof(uint64_t)) ^
+           size;
+}
+
 const SimpleDataHash WeightsSharing::simpleCRC;
 
 WeightsSharing::SharedMemory::SharedMemory(
@@ -31,6 +142,28 @@ bool WeightsSharing::SharedMemory::isValid() const {
 
 void WeightsSharing::SharedMemory::valid(bool b) {
     memory->valid.store(b, std::memory_order_release);
+    if (b)
+        memory->block.publish();
+}
+
+WeightsSharing::MemoryInfo::Ptr WeightsSharing::shareBetweenProcesses(const std::string& key,
+                                                                      MemoryPtr& newPtr,
+                                                                      bool valid) {
+    const auto size = newPtr->GetSize();
+    auto block = segment->acquire(keyPrefix + key, size);
+    if (!block)
+        return std::make_shared<MemoryInfo>(newPtr, valid);
+
+    if (!block.isReady() && valid) {
+        // the data is created already, so publish it at once
+        cpu_memcpy(block.data(), newPtr->GetData(), size);
+        block.publish();
+    }
+    // the process local copy is released when newPtr is replaced
+    auto sharedPtr = std::make_shared<Memory>(newPtr->getEngine());
+    sharedPtr->Create(newPtr->getDescPtr(), block.data(), false);
+    newPtr = sharedPtr;
+    return std::make_shared<MemoryInfo>(newPtr, block.isReady(), block);
 }
 
 WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
@@ -46,7 +179,7 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
+            ptr = segment ? shareBetweenProcesses(key, newPtr, valid) : std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
     }
@@ -55,6 +188,29 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+std::string WeightsSharing::dataKey(const void* data, size_t size) const {
+    if (segment)
+        return std::to_string(simpleCRC.hash(static_cast<const unsigned char*>(data), size));
+    return std::to_string(reinterpret_cast<uint64_t>(data));
+}
+
+std::string WeightsSharing::constDataKey(const void* data, size_t size) {
+    if (!segment)
+        return dataKey(data, size);
+
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        auto found = constDataKeys.find(data);
+        if (found != constDataKeys.end() && found->second.first == size)
+            return found->second.second;
+    }
+    // graphs of several streams may hash the same data concurrently, the result is the same anyway
+    auto key = dataKey(data, size);
+    std::unique_lock<std::mutex> lock(guard);
+    constDataKeys[data] = {size, key};
+    return key;
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
@@ -71,9 +227,10 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
-NumaNodesWeights::NumaNodesWeights() {
+NumaNodesWeights::NumaNodesWeights(const SharedWeightsSegment::Ptr& segment) {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<WeightsSharing>();
+        _cache_map[numa_id] = segment ? std::make_shared<WeightsSharing>(segment, std::to_string(numa_id) + ":")
+                                      : std::make_shared<WeightsSharing>();
 }
 
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
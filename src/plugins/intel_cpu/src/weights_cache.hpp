@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "shared_weights_segment.h"
 
 #include <unordered_map>
 #include <functional>
@@ -23,28 +24,24 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * 64-bit hash of a memory block, stable between processes of the same machine.
+ * The data is consumed by four interleaved CRC32C (Castagnoli) lanes using the SSE4.2 crc32 instruction
+ * if it is available, blocks larger than kChunkSize are split into chunks hashed in parallel.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    SimpleDataHash();
+
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
 protected:
+    uint64_t hashChunk(const unsigned char* data, size_t size) const;
+
+    static constexpr size_t kChunkSize = 1 << 20;
     static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    uint32_t table[kTableSize];
+    bool useCrcInstruction = false;
 };
 
 /**
@@ -57,19 +54,31 @@ class WeightsSharing {
     struct MemoryInfo {
         typedef std::shared_ptr<MemoryInfo> Ptr;
 
-        MemoryInfo(MemoryPtr memoryPtr, bool valid)
+        MemoryInfo(MemoryPtr memoryPtr, bool valid, SharedWeightsSegment::Block block = {})
             : sharedMemory(memoryPtr)
             , valid(valid)
+            , block(block)
         {}
 
         std::mutex guard;
         std::weak_ptr<Memory> sharedMemory;
         std::atomic<bool> valid;
+        SharedWeightsSegment::Block block;  // shared memory the data lives in, empty if it is process local
     };
 
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    WeightsSharing() = default;
+
+    /**
+     * Keeps data in the segment shared with other processes if the segment has room for it
+     * @param segment shared memory segment of the compiled model
+     * @param keyPrefix distinguishes data of different caches in the same segment
+     */
+    WeightsSharing(SharedWeightsSegment::Ptr segment, std::string keyPrefix)
+        : segment(std::move(segment)), keyPrefix(std::move(keyPrefix)) {}
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -96,10 +105,27 @@ public:
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    /**
+     * Identifies the data in keys: by the address if the cache is process local and by the content
+     * if the cache is shared with other processes, where the data has other addresses
+     */
+    std::string dataKey(const void* data, size_t size) const;
+
+    /**
+     * Same as dataKey for data keeping its address and content while the cache lives, e.g. constants of
+     * the compiled model. The content hash is calculated once and reused by graphs of all streams
+     */
+    std::string constDataKey(const void* data, size_t size);
+
 protected:
+    MemoryInfo::Ptr shareBetweenProcesses(const std::string& key, MemoryPtr& newPtr, bool valid);
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    std::unordered_map<const void*, std::pair<size_t, std::string>> constDataKeys;
     static const SimpleDataHash simpleCRC;
+    SharedWeightsSegment::Ptr segment;
+    std::string keyPrefix;
 };
 
 /**
@@ -109,7 +135,10 @@ protected:
  */
 class NumaNodesWeights {
 public:
-    NumaNodesWeights();
+    /**
+     * @param segment shared memory segment for data of all NUMA nodes, nullptr keeps data in process memory
+     */
+    explicit NumaNodesWeights(const SharedWeightsSegment::Ptr& segment = nullptr);
 
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
@@ -0,0 +1,142 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/file_utils.hpp"
+#include "openvino/opsets/opset9.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/util/file_util.hpp"
+#include "test_utils/gate_op.hpp"
+
+using namespace CPUTestUtils;
+
+namespace {
+
+// this tests load plugin by library name: this is not available during static linkage
+#ifndef OPENVINO_STATIC_LIBRARY
+
+class HeteroSubgraphsDagTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        try {
+            core.register_plugin(ov::util::make_plugin_library_name(CommonTestUtils::getExecutableDirectory(),
+                                                                    std::string("openvino_template_plugin") +
+                                                                        IE_BUILD_POSTFIX),
+                                 "TEMPLATE");
+        } catch (const ov::Exception& ex) {
+            if (std::string{ex.what()}.find("is already registered") == std::string::npos)
+                throw;
+        }
+        events = std::make_shared<GateEvents>();
+    }
+
+    std::shared_ptr<ov::opset9::Parameter> makeParameter(const std::string& name, const std::string& device) {
+        auto param = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 4});
+        param->set_friendly_name(name);
+        setAffinity(param, device);
+        return param;
+    }
+
+    std::shared_ptr<ov::Node> makeGate(const ov::Output<ov::Node>& arg, const std::string& device,
+                                       const std::string& id, const std::string& waitFor = {},
+                                       std::chrono::milliseconds timeout = std::chrono::seconds(10),
+                                       const std::string& failure = {}) {
+        auto gate = std::make_shared<Gate>(arg, events, id, waitFor, timeout, failure);
+        gate->set_friendly_name(id);
+        setAffinity(gate, device);
+        return gate;
+    }
+
+    std::shared_ptr<ov::opset9::Result> makeResult(const ov::Output<ov::Node>& arg, const std::string& device) {
+        auto result = std::make_shared<ov::opset9::Result>(arg);
+        setAffinity(result, device);
+        return result;
+    }
+
+    static void setAffinity(const std::shared_ptr<ov::Node>& node, const std::string& device) {
+        node->get_rt_info()["affinity"] = device;
+    }
+
+    ov::Core core;
+    std::shared_ptr<GateEvents> events;
+};
+
+TEST_F(HeteroSubgraphsDagTest, IndependentSubgraphsOverlap) {
+    // every branch waits until the other one is started, so both have to be launched before either finishes
+    auto a = makeParameter("a", "TEMPLATE");
+    auto b = makeParameter("b", "CPU");
+    auto gateA = makeGate(a, "TEMPLATE", "A", "B:start");
+    auto gateB = makeGate(b, "CPU", "B", "A:start");
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{makeResult(gateA, "TEMPLATE"), makeResult(gateB, "CPU")},
+                                             ov::ParameterVector{a, b});
+
+    auto request = core.compile_model(model, "HETERO:TEMPLATE,CPU").create_infer_request();
+    const std::vector<float> values{1.f, 2.f, 3.f, 4.f};
+    for (const auto& input : model->inputs()) {
+        std::copy(values.begin(), values.end(), request.get_tensor(input).data<float>());
+    }
+    request.infer();
+
+    EXPECT_TRUE(events->contains("A:waited"));
+    EXPECT_TRUE(events->contains("B:waited"));
+    for (const auto& output : model->outputs()) {
+        auto tensor = request.get_tensor(output);
+        EXPECT_EQ(values, std::vector<float>(tensor.data<float>(), tensor.data<float>() + tensor.get_size()));
+    }
+}
+
+TEST_F(HeteroSubgraphsDagTest, ConsumerStartsAfterProducer) {
+    // the producer gives the consumer a chance to start early before it finishes
+    auto param = makeParameter("param", "CPU");
+    auto producer = makeGate(param, "CPU", "P", "C:start", std::chrono::milliseconds(200));
+    auto consumer = makeGate(producer, "TEMPLATE", "C");
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{makeResult(consumer, "TEMPLATE")},
+                                             ov::ParameterVector{param});
+
+    auto request = core.compile_model(model, "HETERO:TEMPLATE,CPU").create_infer_request();
+    request.infer();
+
+    EXPECT_FALSE(events->contains("P:waited"));
+    EXPECT_LT(events->position("P:end"), events->position("C:start"));
+}
+
+TEST_F(HeteroSubgraphsDagTest, FailureStopsLaunchesAndAwaitsRunningSubgraphs) {
+    // A fails at once. B is running at that moment and finishes successfully, its consumer C must not be launched.
+    // D is running too and fails later, its error must not replace the first one.
+    auto a = makeParameter("a", "TEMPLATE");
+    auto b = makeParameter("b", "CPU");
+    auto d = makeParameter("d", "CPU");
+    auto gateA = makeGate(a, "TEMPLATE", "A", {}, {}, "first failure");
+    auto gateB = makeGate(b, "CPU", "B", "A:end");
+    auto gateC = makeGate(gateB, "TEMPLATE", "C");
+    auto gateD = makeGate(d, "CPU", "D", "C:start", std::chrono::seconds(1), "second failure");
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{makeResult(gateA, "TEMPLATE"),
+                                                              makeResult(gateC, "TEMPLATE"),
+                                                              makeResult(gateD, "CPU")},
+                                             ov::ParameterVector{a, b, d});
+
+    auto request = core.compile_model(model, "HETERO:TEMPLATE,CPU").create_infer_request();
+    try {
+        request.infer();
+        FAIL() << "Failure of a subgraph isn't propagated";
+    } catch (const std::exception& ex) {
+        EXPECT_THAT(ex.what(), ::testing::HasSubstr("first failure"));
+        EXPECT_THAT(ex.what(), ::testing::Not(::testing::HasSubstr("second failure")));
+    }
+
+    EXPECT_TRUE(events->contains("B:end"));
+    EXPECT_TRUE(events->contains("D:end"));
+    EXPECT_FALSE(events->contains("C:start"));
+}
+
+#endif  // !OPENVINO_STATIC_LIBRARY
+
+}  // namespace
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "openvino/opsets/opset9.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/exception.hpp"
+#include "test_utils/gate_op.hpp"
+
+using namespace CPUTestUtils;
+
+namespace {
+
+// MULTI with the only CPU device passes inferences through to CPU requests, which are ordered and dropped
+// by the single CPU stream according to the scheduling hint passed by MULTI requests
+class MultiSchedulingHintTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        core.set_property("CPU", ov::num_streams(1));
+        events = std::make_shared<GateEvents>();
+    }
+
+    ov::CompiledModel compileModel(const std::string& waitFor, std::chrono::milliseconds timeout) {
+        auto param = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 4});
+        auto gate = std::make_shared<Gate>(param, events, "G", waitFor, timeout);
+        auto result = std::make_shared<ov::opset9::Result>(gate);
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+        return core.compile_model(model, "MULTI:CPU");
+    }
+
+    ov::Core core;
+    std::shared_ptr<GateEvents> events;
+};
+
+TEST_F(MultiSchedulingHintTest, RequestExpiredInQueueIsDropped) {
+    auto compiledModel = compileModel("release", std::chrono::seconds(10));
+    auto blockingRequest = compiledModel.create_infer_request();
+    auto hintedRequest = compiledModel.create_infer_request();
+
+    blockingRequest.start_async();
+    ASSERT_TRUE(events->wait("G:start", std::chrono::seconds(10)));
+    hintedRequest.set_scheduling_hint(ov::hint::Priority::HIGH, std::chrono::milliseconds(10), true);
+    hintedRequest.start_async();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    events->record("release");
+
+    ASSERT_NO_THROW(blockingRequest.wait());
+    ASSERT_THROW(hintedRequest.wait(), ov::Cancelled);
+}
+
+TEST_F(MultiSchedulingHintTest, RequestExpiredInQueueIsExecutedIfNotRequestedToDrop) {
+    auto compiledModel = compileModel("release", std::chrono::seconds(10));
+    auto blockingRequest = compiledModel.create_infer_request();
+    auto hintedRequest = compiledModel.create_infer_request();
+
+    blockingRequest.start_async();
+    ASSERT_TRUE(events->wait("G:start", std::chrono::seconds(10)));
+    hintedRequest.set_scheduling_hint(ov::hint::Priority::HIGH, std::chrono::milliseconds(10), false);
+    hintedRequest.start_async();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    events->record("release");
+
+    ASSERT_NO_THROW(blockingRequest.wait());
+    ASSERT_NO_THROW(hintedRequest.wait());
+}
+
+TEST_F(MultiSchedulingHintTest, RequestExpiredDuringInferenceIsCompleted) {
+    // nothing releases the gate, so the inference lasts for the whole timeout
+    auto compiledModel = compileModel("release", std::chrono::milliseconds(100));
+    auto request = compiledModel.create_infer_request();
+    request.set_scheduling_hint(ov::hint::Priority::HIGH, std::chrono::milliseconds(10), true);
+
+    ASSERT_NO_THROW(request.infer());
+    ASSERT_TRUE(events->contains("G:end"));
+}
+
+}  // namespace
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ie_system_conf.h"
+
+#include <openvino/opsets/opset9.hpp>
+#include <ie/ie_core.hpp>
+
+namespace {
+
+using namespace InferenceEngine;
+
+class PreprocessingFoldedMeanTest : public ::testing::TestWithParam<Precision> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<Precision>& obj) {
+        return std::string("netPRC=") + obj.param.name();
+    }
+
+protected:
+    // The mean values and scales of BF16 and I8 network inputs are applied by the preprocessing converting
+    // the user blob, the plugin must not apply them again
+    static Blob::Ptr Infer(Precision inputPrecision, float stdScale, const Blob::Ptr& input) {
+        auto param = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 3, 8, 8});
+        auto constant = ngraph::builder::makeConstant<float>(ov::element::f32, {1, 3, 1, 1}, {0.5f, 1.f, 2.f});
+        auto multiply = std::make_shared<ov::opset9::Multiply>(param, constant);
+        CNNNetwork network(std::make_shared<ov::Model>(ov::NodeVector{multiply}, ov::ParameterVector{param}));
+
+        auto& inputInfo = network.getInputsInfo().begin()->second;
+        inputInfo->setPrecision(inputPrecision);
+        inputInfo->setLayout(Layout::NCHW);
+        auto& preProcess = inputInfo->getPreProcess();
+        preProcess.init(3);
+        const float means[] = {128.f, 100.f, 150.f};
+        for (size_t c = 0; c < 3; c++) {
+            preProcess[c]->meanValue = means[c];
+            preProcess[c]->stdScale = stdScale;
+        }
+        preProcess.setVariant(MEAN_VALUE);
+
+        Core ie;
+        auto request = ie.LoadNetwork(network, "CPU").CreateInferRequest();
+        request.SetBlob(network.getInputsInfo().begin()->first, input);
+        request.Infer();
+        return request.GetBlob(network.getOutputsInfo().begin()->first);
+    }
+};
+
+TEST_P(PreprocessingFoldedMeanTest, EqualsPluginNormalization) {
+    const auto precision = GetParam();
+    if (precision == Precision::BF16 && !with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    // the user blob is converted by the preprocessing in both cases, the values are chosen to be exact in I8 and BF16
+    Blob::Ptr input = make_shared_blob<uint8_t>({Precision::U8, {1, 3, 8, 8}, Layout::NCHW});
+    input->allocate();
+    CommonTestUtils::fill_data_random<Precision::U8>(input, 100, 50);
+    const float stdScale = precision == Precision::I8 ? 1.f : 2.f;
+
+    auto expected = Infer(Precision::FP32, stdScale, input);
+    auto actual = Infer(precision, stdScale, input);
+
+    ASSERT_EQ(expected->size(), actual->size());
+    const auto expectedData = expected->cbuffer().as<const float*>();
+    const auto actualData = actual->cbuffer().as<const float*>();
+    for (size_t i = 0; i < expected->size(); i++) {
+        ASSERT_EQ(expectedData[i], actualData[i]) << "element " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_PreprocessingFoldedMean, PreprocessingFoldedMeanTest,
+                         ::testing::Values(Precision::I8, Precision::BF16),
+                         PreprocessingFoldedMeanTest::getTestCaseName);
+}  // namespace
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+#include <openvino/opsets/opset9.hpp>
+#include <ie/ie_core.hpp>
+#include <set>
+
+namespace {
+
+const std::string pipelineDepthKey = InferenceEngine::PluginConfigInternalParams::KEY_CPU_PREPROCESSING_PIPELINE_DEPTH;
+
+std::shared_ptr<ov::Model> MakeConvReluModel(const ov::PartialShape& inputShape) {
+    auto param = std::make_shared<ov::opset9::Parameter>(ov::element::f32, inputShape);
+    auto weights = ngraph::builder::makeConstant<float>(ov::element::f32, {4, 3, 3, 3}, {}, true);
+    auto conv = std::make_shared<ov::opset9::Convolution>(param, weights, ov::Strides{1, 1},
+                                                          ov::CoordinateDiff{1, 1}, ov::CoordinateDiff{1, 1},
+                                                          ov::Strides{1, 1});
+    auto relu = std::make_shared<ov::opset9::Relu>(conv);
+    return std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{param}, "ConvRelu");
+}
+
+// The batch of every inference is taken from the input tensor, the pipelined requests must use it
+// for preprocessing and inference of this very inference, not the batch of the previous one
+TEST(PreprocessingPipelineTest, NewApiDynamicBatch) {
+    auto model = MakeConvReluModel({ov::Dimension(1, 4), 3, 8, 8});
+    ov::Core core;
+    auto refModel = core.compile_model(model, "CPU");
+    auto pipelinedModel = core.compile_model(model, "CPU", {{pipelineDepthKey, "2"}});
+    auto refRequest = refModel.create_infer_request();
+    auto pipelinedRequest = pipelinedModel.create_infer_request();
+
+    for (size_t batch : {4, 1, 3, 2}) {
+        auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, {batch, 3, 8, 8}, 10, -5, 1,
+                                                             static_cast<int>(batch));
+        refRequest.set_input_tensor(input);
+        refRequest.infer();
+        pipelinedRequest.set_input_tensor(input);
+        pipelinedRequest.start_async();
+        pipelinedRequest.wait();
+
+        auto expected = refRequest.get_output_tensor();
+        auto actual = pipelinedRequest.get_output_tensor();
+        ASSERT_EQ(expected.get_shape(), actual.get_shape());
+        ov::test::utils::compare(expected, actual, 1e-5, 1e-5);
+    }
+}
+
+// Legacy resize preprocessing runs on the preprocessing executor for the batch set by the user
+TEST(PreprocessingPipelineTest, LegacyDynamicBatchWithResize) {
+    InferenceEngine::Core ie;
+    InferenceEngine::CNNNetwork network(MakeConvReluModel({4, 3, 8, 8}));
+    auto& inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->getPreProcess().setResizeAlgorithm(InferenceEngine::ResizeAlgorithm::RESIZE_BILINEAR);
+    inputInfo->setLayout(InferenceEngine::Layout::NCHW);
+    inputInfo->setPrecision(InferenceEngine::Precision::FP32);
+    const std::string inputName = network.getInputsInfo().begin()->first;
+    const std::string outputName = network.getOutputsInfo().begin()->first;
+
+    std::map<std::string, std::string> config{{CONFIG_KEY(DYN_BATCH_ENABLED), CONFIG_VALUE(YES)}};
+    auto refNetwork = ie.LoadNetwork(network, "CPU", config);
+    config[pipelineDepthKey] = "1";
+    auto pipelinedNetwork = ie.LoadNetwork(network, "CPU", config);
+    auto refRequest = refNetwork.CreateInferRequest();
+    auto pipelinedRequest = pipelinedNetwork.CreateInferRequest();
+
+    InferenceEngine::Blob::Ptr input = InferenceEngine::make_shared_blob<float>(
+        {InferenceEngine::Precision::FP32, {4, 3, 16, 16}, InferenceEngine::Layout::NCHW});
+    input->allocate();
+    CommonTestUtils::fill_data_random<InferenceEngine::Precision::FP32>(input, 10, -5);
+
+    for (int batch : {2, 4, 1}) {
+        refRequest.SetBlob(inputName, input);
+        refRequest.SetBatch(batch);
+        refRequest.Infer();
+        pipelinedRequest.SetBlob(inputName, input);
+        pipelinedRequest.SetBatch(batch);
+        pipelinedRequest.StartAsync();
+        pipelinedRequest.Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+
+        auto expected = refRequest.GetBlob(outputName);
+        auto actual = pipelinedRequest.GetBlob(outputName);
+        const auto expectedData = expected->cbuffer().as<const float*>();
+        const auto actualData = actual->cbuffer().as<const float*>();
+        // only the first batch items are computed
+        const size_t size = expected->size() / 4 * batch;
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_NEAR(expectedData[i], actualData[i], 1e-5) << "batch " << batch << " element " << i;
+        }
+    }
+}
+
+TEST(PreprocessingPipelineTest, PerfCountersReportStages) {
+    ov::Core core;
+    auto compiledModel = core.compile_model(MakeConvReluModel({1, 3, 8, 8}), "CPU",
+                                            {{pipelineDepthKey, "1"}, ov::enable_profiling(true)});
+    auto request = compiledModel.create_infer_request();
+    request.start_async();
+    request.wait();
+
+    std::set<std::string> stages;
+    for (const auto& info : request.get_profiling_info()) {
+        if (info.node_type == "PipelineStage") {
+            stages.insert(info.node_name);
+            EXPECT_EQ(ov::ProfilingInfo::Status::EXECUTED, info.status);
+        }
+    }
+    const std::set<std::string> expectedStages{"PipelineStage_Preprocessing",
+                                               "PipelineStage_Waiting",
+                                               "PipelineStage_Inference"};
+    EXPECT_EQ(expectedStages, stages);
+
+    // the stages are not reported without the pipeline
+    auto refRequest = core.compile_model(MakeConvReluModel({1, 3, 8, 8}), "CPU", ov::enable_profiling(true))
+                          .create_infer_request();
+    refRequest.start_async();
+    refRequest.wait();
+    for (const auto& info : refRequest.get_profiling_info()) {
+        EXPECT_NE("PipelineStage", info.node_type);
+    }
+}
+}  // namespace
@@ -234,6 +234,21 @@ TEST(OVClassBasicTest, smoke_SetConfigHintInferencePrecision) {
     ASSERT_EQ(value, forcedPrecision);
 }
 
+TEST(OVClassBasicTest, smoke_SetConfigHintInferencePrecisionFP16) {
+    ov::Core ie;
+    auto value = ov::element::f32;
+    const auto forcedPrecision = ov::element::f16;
+
+    if (!InferenceEngine::with_cpu_x86_avx2()) {
+        ASSERT_THROW(ie.set_property("CPU", ov::hint::inference_precision(forcedPrecision)), ov::Exception);
+        return;
+    }
+
+    OV_ASSERT_NO_THROW(ie.set_property("CPU", ov::hint::inference_precision(forcedPrecision)));
+    OV_ASSERT_NO_THROW(value = ie.get_property("CPU", ov::hint::inference_precision));
+    ASSERT_EQ(value, forcedPrecision);
+}
+
 TEST(OVClassBasicTest, smoke_SetConfigEnableProfiling) {
     ov::Core ie;
     bool value;
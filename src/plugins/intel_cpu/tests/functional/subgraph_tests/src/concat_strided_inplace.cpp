@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Param  Param   Param  Param          Param  Param   Param
+ *      \    /         \    /                \    /        |
+ *      MatMul         MatMul                MatMul       Relu
+ *          \           /                       \          /
+ *           \         /                         \        /
+ *    Concat (axis with non 1 dims before)     Concat (axis with non 1 dims before)
+ *                |                                  |
+ *              Result                             Result
+ *
+ * Inputs of the Concat with only MatMul parents are strided views of its output written by the MatMuls directly,
+ * so the Concat is executed in place. Any other parent makes the Concat copy the data.
+ */
+
+enum class ConcatParents {
+    MatMuls,
+    MatMulAndEltwise,
+};
+
+using ConcatStridedInPlaceParams = std::tuple<
+        std::vector<InputShape>,    // MatMul A, MatMul B, second parent inputs
+        int64_t,                    // concat axis
+        ConcatParents,
+        std::string>;               // expected Concat implementation
+
+class ConcatStridedInPlaceTest : public testing::WithParamInterface<ConcatStridedInPlaceParams>,
+                                 virtual public SubgraphBaseTest,
+                                 public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConcatStridedInPlaceParams>& obj) {
+        std::vector<InputShape> inputShapes;
+        int64_t axis;
+        ConcatParents parents;
+        std::string expectedType;
+        std::tie(inputShapes, axis, parents, expectedType) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=";
+        for (const auto& shape : inputShapes) {
+            result << CommonTestUtils::partialShape2str({shape.first}) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : inputShapes) {
+            result << "(";
+            for (const auto& item : shape.second) {
+                result << CommonTestUtils::vec2str(item);
+            }
+            result << ")_";
+        }
+        result << "axis=" << axis << "_";
+        result << "parents=" << (parents == ConcatParents::MatMuls ? "MatMuls" : "MatMulAndEltwise") << "_";
+        result << "expected=" << expectedType;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::vector<InputShape> inputShapes;
+        int64_t axis;
+        ConcatParents parents;
+        std::tie(inputShapes, axis, parents, selectedType) = this->GetParam();
+        selectedType += "_FP32";
+
+        init_input_shapes(inputShapes);
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], params[1]);
+        std::shared_ptr<ov::Node> secondParent;
+        if (parents == ConcatParents::MatMuls) {
+            secondParent = std::make_shared<ov::op::v0::MatMul>(params[2], params[3]);
+        } else {
+            secondParent = std::make_shared<ov::op::v0::Relu>(params[2]);
+        }
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{matMul, secondParent}, axis);
+
+        function = makeNgraphFunction(ov::element::f32, params, concat, "ConcatStridedInPlace");
+    }
+};
+
+TEST_P(ConcatStridedInPlaceTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "Concatenation");
+}
+
+namespace {
+const std::vector<InputShape> matMulsShapes = {
+    {{}, {{2, 3, 8, 4}}}, {{}, {{2, 3, 4, 8}}}, {{}, {{2, 3, 8, 4}}}, {{}, {{2, 3, 4, 8}}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatStridedInPlace_MatMuls, ConcatStridedInPlaceTest,
+                         ::testing::Combine(
+                                 ::testing::Values(matMulsShapes),
+                                 ::testing::Values(1, 2, 3),
+                                 ::testing::Values(ConcatParents::MatMuls),
+                                 ::testing::Values("unknown")),
+                         ConcatStridedInPlaceTest::getTestCaseName);
+
+const std::vector<InputShape> mixedShapes = {
+    {{}, {{2, 3, 8, 4}}}, {{}, {{2, 3, 4, 8}}}, {{}, {{2, 3, 8, 8}}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatStridedInPlace_MixedParents, ConcatStridedInPlaceTest,
+                         ::testing::Combine(
+                                 ::testing::Values(mixedShapes),
+                                 ::testing::Values(2, 3),
+                                 ::testing::Values(ConcatParents::MatMulAndEltwise),
+                                 ::testing::Values("ref")),
+                         ConcatStridedInPlaceTest::getTestCaseName);
+
+const std::vector<InputShape> dynamicMatMulsShapes = {
+    {{-1, 3, -1, 4}, {{2, 3, 8, 4}, {1, 3, 5, 4}, {2, 3, 8, 4}}},
+    {{-1, 3, 4, 8}, {{2, 3, 4, 8}, {1, 3, 4, 8}, {2, 3, 4, 8}}},
+    {{-1, 3, -1, 4}, {{2, 3, 8, 4}, {1, 3, 5, 4}, {2, 3, 8, 4}}},
+    {{-1, 3, 4, 8}, {{2, 3, 4, 8}, {1, 3, 4, 8}, {2, 3, 4, 8}}}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatStridedInPlace_Dynamic, ConcatStridedInPlaceTest,
+                         ::testing::Combine(
+                                 ::testing::Values(dynamicMatMulsShapes),
+                                 ::testing::Values(2, 3),
+                                 ::testing::Values(ConcatParents::MatMuls),
+                                 ::testing::Values("ref")),
+                         ConcatStridedInPlaceTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *    Param      Param
+ *      |          |
+ *   HSigmoid     Mish
+ *       \        /
+ *   (FP16) \   / (FP16)
+ *        Concat
+ *          | (FP16)
+ *       HSigmoid
+ *          |
+ *        Result
+ *
+ * With inference_precision=f16 the activations between Eltwise and Concat nodes are stored in FP16,
+ * the computations and the model inputs and outputs stay FP32. HSigmoid and Mish are not tokenized
+ * into snippets, so the Eltwise nodes remain in the graph for static shapes too.
+ */
+
+using EltwiseConcatFP16ActivationsParams = std::vector<InputShape>;
+
+class EltwiseConcatFP16ActivationsTest : public testing::WithParamInterface<EltwiseConcatFP16ActivationsParams>,
+                                         virtual public SubgraphBaseTest,
+                                         public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EltwiseConcatFP16ActivationsParams>& obj) {
+        std::ostringstream result;
+        result << "IS=";
+        for (const auto& shape : obj.param) {
+            result << CommonTestUtils::partialShape2str({shape.first}) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : obj.param) {
+            result << "(";
+            for (const auto& item : shape.second) {
+                result << CommonTestUtils::vec2str(item);
+            }
+            result << ")_";
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ov::hint::inference_precision.name(), "f16"});
+        // FP16 storage keeps 11 significant bits
+        abs_threshold = 1e-2;
+        rel_threshold = 1e-2;
+
+        init_input_shapes(GetParam());
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        auto hsigmoid = std::make_shared<ov::op::v5::HSigmoid>(params[0]);
+        auto mish = std::make_shared<ov::op::v4::Mish>(params[1]);
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{hsigmoid, mish}, 1);
+        concat->set_friendly_name("concat");
+        auto output = std::make_shared<ov::op::v5::HSigmoid>(concat);
+        output->set_friendly_name("output");
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(output)}, params,
+                                               "EltwiseConcatFP16Activations");
+    }
+
+    void checkRuntimePrecision(const std::string& name, const std::string& expected) {
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            if (node->get_friendly_name() != name)
+                continue;
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::RUNTIME_PRECISION);
+            ASSERT_NE(rtInfo.end(), it) << name;
+            EXPECT_EQ(expected, it->second.as<std::string>()) << name;
+            return;
+        }
+        FAIL() << "Node " << name << " isn't found in the exec graph";
+    }
+};
+
+TEST_P(EltwiseConcatFP16ActivationsTest, CompareWithRefs) {
+    // FP16 activations use F16C conversions available since AVX2
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    run();
+
+    checkRuntimePrecision("concat", "FP16");
+    checkRuntimePrecision("output", "FP16");
+    for (const auto& output : compiledModel.outputs()) {
+        EXPECT_EQ(ov::element::f32, output.get_element_type());
+    }
+}
+
+namespace {
+// the numbers of elements aren't multiples of the vector length to cover the tails
+const std::vector<EltwiseConcatFP16ActivationsParams> inputShapes = {
+    {
+        {{}, {{1, 3, 19}}},
+        {{}, {{1, 5, 19}}}
+    },
+    {
+        {{}, {{2, 8, 7, 5}}},
+        {{}, {{2, 3, 7, 5}}}
+    },
+    {
+        {{-1, 3, -1}, {{1, 3, 17}, {2, 3, 33}, {1, 3, 9}}},
+        {{-1, 5, -1}, {{1, 5, 17}, {2, 5, 33}, {1, 5, 9}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EltwiseConcatFP16Activations_CPU, EltwiseConcatFP16ActivationsTest,
+                         ::testing::ValuesIn(inputShapes),
+                         EltwiseConcatFP16ActivationsTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
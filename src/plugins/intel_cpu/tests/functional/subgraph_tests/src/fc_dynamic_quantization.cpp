@@ -0,0 +1,124 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *   Param   Constant
+ *       \   /
+ *       MatMul   Constant
+ *          \      /
+ *            Add (optional)
+ *             |
+ *           Result
+ *
+ * MatMul with constant weights and the bias are converted to FullyConnected, with CPU_DYNAMIC_QUANTIZATION=YES
+ * its activations are quantized to INT8 at runtime. The result is compared with the FP32 reference
+ * within the quantization error.
+ */
+
+using FCDynamicQuantizationParams = std::tuple<
+        InputShape,     // activations shape, the last dimension is the number of input channels
+        size_t,         // number of output channels
+        bool>;          // with bias
+
+class FCDynamicQuantizationTest : public testing::WithParamInterface<FCDynamicQuantizationParams>,
+                                  virtual public SubgraphBaseTest,
+                                  public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCDynamicQuantizationParams>& obj) {
+        InputShape inputShape;
+        size_t outputChannels;
+        bool withBias;
+        std::tie(inputShape, outputChannels, withBias) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& item : inputShape.second) {
+            result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "OC=" << outputChannels << "_";
+        result << "bias=" << withBias;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        InputShape inputShape;
+        size_t outputChannels;
+        bool withBias;
+        std::tie(inputShape, outputChannels, withBias) = GetParam();
+        configuration.insert({ov::intel_cpu::dynamic_quantization.name(), InferenceEngine::PluginConfigParams::YES});
+        // per row INT8 quantization of both activations and weights in [-1, 1]
+        abs_threshold = 0.15;
+
+        init_input_shapes({inputShape});
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const size_t inputChannels = inputDynamicShapes[0].rbegin()->get_length();
+        auto weights = ngraph::builder::makeConstant<float>(ov::element::f32, {outputChannels, inputChannels}, {},
+                                                            true, 1.f, -1.f);
+        std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v0::MatMul>(params[0], weights, false, true);
+        if (withBias) {
+            auto bias = ngraph::builder::makeConstant<float>(ov::element::f32, {outputChannels}, {}, true, 1.f, -1.f);
+            output = std::make_shared<ov::op::v1::Add>(output, bias);
+        }
+
+        function = makeNgraphFunction(ov::element::f32, params, output, "FCDynamicQuantization");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(),
+                                                                  targetInputStaticShapes[i], 2, -1, 1000);
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(FCDynamicQuantizationTest, CompareWithRefs) {
+    run();
+
+    // the bias is fused into FullyConnected, post ops aren't fused into the dynamically quantized one
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+    // the dynamic quantization is enabled on both VNNI flavors
+    if (!InferenceEngine::with_cpu_x86_avx512_core_vnni() && !InferenceEngine::with_cpu_x86_avx2_vnni())
+        return;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() == "FullyConnected") {
+            EXPECT_EQ("I8", rtInfo.at(ExecGraphInfoSerialization::RUNTIME_PRECISION).as<std::string>());
+        }
+    }
+}
+
+namespace {
+const std::vector<InputShape> inputShapes = {
+    {{}, {{16, 64}}},
+    {{}, {{2, 5, 96}}},
+    {{-1, 64}, {{16, 64}, {3, 64}, {16, 64}}},
+    {{-1, -1, 96}, {{2, 5, 96}, {1, 17, 96}, {2, 5, 96}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCDynamicQuantization_CPU, FCDynamicQuantizationTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(32, 67),
+                                 ::testing::Bool()),
+                         FCDynamicQuantizationTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
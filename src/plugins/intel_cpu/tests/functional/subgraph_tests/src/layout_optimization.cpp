@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *            Parameter
+ *                |
+ *             MaxPool
+ *             /     \
+ *   Convolution  ...  Convolution
+ *        |                 |
+ *      Result            Result
+ *
+ * MaxPool supports both planar and blocked layouts and initially follows the planar layout of the Parameter,
+ * while the convolutions prefer the blocked one. With several convolutions a single reorder before MaxPool
+ * is cheaper than a reorder per convolution, so the layout optimization switches MaxPool to the blocked layout.
+ * With one convolution both choices cost one reorder and MaxPool keeps its layout.
+ */
+
+class LayoutOptimizationTest : public testing::WithParamInterface<size_t>,
+                               virtual public SubgraphBaseTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<size_t>& obj) {
+        std::ostringstream result;
+        result << "convolutions=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const size_t convolutions = GetParam();
+
+        init_input_shapes(static_shapes_to_test_representation({{1, 32, 16, 16}}));
+        auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        auto pool = std::make_shared<ov::op::v1::MaxPool>(params[0], ov::Strides{1, 1}, ov::Shape{1, 1},
+                                                          ov::Shape{1, 1}, ov::Shape{3, 3});
+        ov::ResultVector results;
+        for (size_t i = 0; i < convolutions; i++) {
+            auto conv = ngraph::builder::makeConvolution(pool, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                         {1, 1}, ov::op::PadType::EXPLICIT, 32);
+            results.push_back(std::make_shared<ov::op::v0::Result>(conv));
+        }
+        function = std::make_shared<ov::Model>(results, params, "LayoutOptimization");
+    }
+
+    size_t getRuntimeModelStat(const std::string& name) {
+        const auto& rtInfo = compiledModel.get_runtime_model()->get_rt_info();
+        auto it = rtInfo.find(name);
+        if (it == rtInfo.end())
+            return 0;
+        return std::stoul(it->second.as<std::string>());
+    }
+};
+
+TEST_P(LayoutOptimizationTest, CompareWithRefs) {
+    // the convolutions have to prefer a blocked layout
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    run();
+
+    const size_t reordersAvoided = getRuntimeModelStat("reordersAvoided");
+    const size_t reordersRemaining = getRuntimeModelStat("reordersRemaining");
+    if (GetParam() > 1) {
+        // one reorder before MaxPool instead of a reorder per convolution
+        EXPECT_EQ(GetParam() - 1, reordersAvoided);
+    } else {
+        EXPECT_EQ(0u, reordersAvoided);
+    }
+    // the reorders inserted into the graph are the ones estimated by the optimization
+    CheckNumberOfNodesWithType(compiledModel, "Reorder", reordersRemaining);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_LayoutOptimization_CPU, LayoutOptimizationTest,
+                         ::testing::Values(1, 2, 3),
+                         LayoutOptimizationTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
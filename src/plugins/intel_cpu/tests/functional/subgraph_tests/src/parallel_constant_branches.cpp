@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/pass/constant_folding.hpp"
+
+using namespace CPUTestUtils;
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *  Constant  Constant      Multiply(Constant, Constant)  Multiply(Constant, Constant)
+ *        \    /                                 \    /
+ *     Convolution   x branches                  MatMul   x branches
+ *           |                                     |
+ *   Parameter -- Add                      Parameter -- Add
+ *           |                                     |
+ *        Result                                Result
+ *
+ * Constant folding is disabled for the Convolution, Multiply and MatMul nodes, so they are constant nodes
+ * of the CPU graph on the same level. They are executed concurrently, but Convolution and MatMul share
+ * the graph scratchpad, so the results must match the sequential reference.
+ */
+
+class ParallelConstantBranchesTest : public testing::WithParamInterface<size_t>,
+                                     virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<size_t> obj) {
+        std::ostringstream result;
+        result << "branches=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const size_t branches = GetParam();
+
+        auto params = builder::makeParams(element::f32, {{1, 8, 16, 16}, {2, 16, 16}});
+        ResultVector results;
+        for (size_t i = 0; i < branches; i++) {
+            const int seed = static_cast<int>(i) + 1;
+            auto convInput = builder::makeConstant<float>(element::f32, {1, 8, 16, 16}, {}, true, 1.f, -1.f, seed);
+            auto convWeights = builder::makeConstant<float>(element::f32, {8, 8, 3, 3}, {}, true, 1.f, -1.f, seed);
+            auto conv = std::make_shared<opset1::Convolution>(convInput, convWeights, Strides{1, 1},
+                                                              CoordinateDiff{1, 1}, CoordinateDiff{1, 1},
+                                                              Strides{1, 1});
+            ov::pass::disable_constant_folding(conv);
+            results.push_back(std::make_shared<opset1::Result>(std::make_shared<opset1::Add>(params[0], conv)));
+
+            // both MatMul inputs are non-Constant nodes, so MatMul is not converted to FullyConnected
+            auto matmulA = std::make_shared<opset1::Multiply>(
+                builder::makeConstant<float>(element::f32, {2, 16, 32}, {}, true, 1.f, -1.f, seed),
+                opset1::Constant::create(element::f32, {}, {1.f}));
+            ov::pass::disable_constant_folding(matmulA);
+            auto matmulB = std::make_shared<opset1::Multiply>(
+                builder::makeConstant<float>(element::f32, {2, 32, 16}, {}, true, 1.f, -1.f, seed),
+                opset1::Constant::create(element::f32, {}, {1.f}));
+            ov::pass::disable_constant_folding(matmulB);
+            auto matmul = std::make_shared<opset1::MatMul>(matmulA, matmulB);
+            ov::pass::disable_constant_folding(matmul);
+            results.push_back(std::make_shared<opset1::Result>(std::make_shared<opset1::Add>(params[1], matmul)));
+        }
+        function = std::make_shared<Function>(results, params, "ParallelConstantBranches");
+    }
+};
+
+TEST_P(ParallelConstantBranchesTest, CompareWithRefs) {
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "Convolution", GetParam());
+    CheckNumberOfNodesWithType(executableNetwork, "MatMul", GetParam());
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelConstantBranches_CPU, ParallelConstantBranchesTest,
+                         ::testing::Values(1, 4, 8),
+                         ParallelConstantBranchesTest::getTestCaseName);
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,115 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "openvino/op/op.hpp"
+
+namespace CPUTestUtils {
+
+// Events recorded by gates, shared by the clones of the gates made by the plugins
+class GateEvents {
+public:
+    void record(const std::string& event) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _events.push_back(event);
+        }
+        _cv.notify_all();
+    }
+
+    bool wait(const std::string& event, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _cv.wait_for(lock, timeout, [&] {
+            return std::find(_events.begin(), _events.end(), event) != _events.end();
+        });
+    }
+
+    bool contains(const std::string& event) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return std::find(_events.begin(), _events.end(), event) != _events.end();
+    }
+
+    // position of the event in the recorded order, the number of events if it isn't recorded
+    size_t position(const std::string& event) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return std::find(_events.begin(), _events.end(), event) - _events.begin();
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::vector<std::string> _events;
+};
+
+// Copies its input to the output. Before that it waits for an event of another gate for at most the timeout,
+// after that it throws if a failure message is set. Both CPU (reference fallback) and TEMPLATE execute it
+// by the evaluate method, so tests can control the order of inferences of the devices.
+class Gate : public ov::op::Op {
+public:
+    OPENVINO_OP("Gate", "hetero_test_opset");
+
+    Gate() = default;
+    Gate(const ov::Output<ov::Node>& arg,
+         std::shared_ptr<GateEvents> events,
+         std::string id,
+         std::string waitFor = {},
+         std::chrono::milliseconds timeout = std::chrono::seconds(10),
+         std::string failure = {})
+        : Op({arg}),
+          _events(std::move(events)),
+          _id(std::move(id)),
+          _waitFor(std::move(waitFor)),
+          _timeout(timeout),
+          _failure(std::move(failure)) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        return std::make_shared<Gate>(new_args.at(0), _events, _id, _waitFor, _timeout, _failure);
+    }
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override {
+        return true;
+    }
+
+    bool has_evaluate() const override {
+        return true;
+    }
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override {
+        _events->record(_id + ":start");
+        if (!_waitFor.empty() && _events->wait(_waitFor, _timeout)) {
+            _events->record(_id + ":waited");
+        }
+        std::memcpy(outputs[0].data(), inputs[0].data(), inputs[0].get_byte_size());
+        _events->record(_id + ":end");
+        if (!_failure.empty()) {
+            throw ov::Exception(_failure);
+        }
+        return true;
+    }
+
+private:
+    std::shared_ptr<GateEvents> _events;
+    std::string _id;
+    std::string _waitFor;
+    std::chrono::milliseconds _timeout{};
+    std::string _failure;
+};
+
+}  // namespace CPUTestUtils
@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 #include <utils/jit_kernel.hpp>
+#include <openvino/core/type/float16.hpp>
+#include <memory>
 #include <random>
 
 using namespace ov::intel_cpu;
@@ -299,10 +301,42 @@ struct jit_variable_load_store_test_kernel {
         ASSERT_EQ(result, expected_result);
     }
 
+    // Loads and stores the constant number of elements, the emitters process the tail of the register.
+    // If the tail is filled, the loaded register is stored completely, so the filled ones are stored too.
+    template<size_t N, bool is_src>
+    void test_tail(size_t length, bool fill = false) {
+        kernel_impl<N, is_src> kernel(length, fill);
+        kernel.init();
+
+        std::array<SrcT, N> src {};
+        std::array<DstT, N> result {};
+
+        Params args = { src.data(), result.data(), length };
+
+        src.fill(static_cast<SrcT>(42));
+        for (size_t i = 0; i < length; ++i) {
+            src[i] = static_cast<SrcT>(i);
+        }
+
+        kernel(args);
+
+        std::array<DstT, N> expected_result {};
+
+        for (size_t i = 0; i < N; ++i) {
+            expected_result[i] = static_cast<DstT>(i < length ? i : (fill ? 1 : 0));
+        }
+
+        ASSERT_EQ(result, expected_result) << "length: " << length << ", fill: " << fill;
+    }
+
 private:
     template<size_t N, bool is_src>
     class kernel_impl : public jit_test_kernel<Params> {
     public:
+        // zero length means the length passed in runtime
+        explicit kernel_impl(size_t length = 0, bool fill = false)
+            : _length(length), _fill(fill) {}
+
         void generate() override {
             jit_kernel::preamble();
 
@@ -310,13 +344,37 @@ private:
             auto dst_ptr = jit_kernel::arg(&Params::dst);
             auto size = jit_kernel::arg(&Params::size);
 
-            auto interm = jit_kernel::var<typename std::conditional<is_src, SrcT[N], DstT[N]>::type>();
-
-            jit_kernel::load(interm, src_ptr, size);
-            jit_kernel::store(dst_ptr, interm, size);
+            using interm_type = typename std::conditional<is_src, SrcT, DstT>::type;
+            auto interm = jit_kernel::var<interm_type[N]>();
+
+            if (_length == 0) {
+                jit_kernel::load(interm, src_ptr, size);
+                jit_kernel::store(dst_ptr, interm, size);
+            } else if (!_fill) {
+                jit_kernel::load(interm, src_ptr, _length);
+                jit_kernel::store(dst_ptr, interm, _length);
+            } else {
+                _fill_emitter.reset(new jit_load_emitter(this, internal::get_current_isa(),
+                                                         internal::type2precision<SrcT>(),
+                                                         internal::type2precision<interm_type>(),
+                                                         static_cast<int>(_length),
+                                                         InferenceEngine::Precision::FP32, true, "float_one"));
+                _fill_emitter->emit_code(
+                    { static_cast<size_t>(static_cast<const Xbyak::Operand&>(src_ptr).getIdx()) },
+                    { static_cast<size_t>(static_cast<const Xbyak::Operand&>(interm).getIdx()) });
+                jit_kernel::store(dst_ptr, interm);
+            }
 
             jit_kernel::postamble();
+            if (_fill_emitter) {
+                _fill_emitter->emit_data();
+            }
         }
+
+    private:
+        size_t _length;
+        bool _fill;
+        std::unique_ptr<jit_load_emitter> _fill_emitter;
     };
 };
 
@@ -372,6 +430,65 @@ TEST(JitKernel, variable_load_and_store) {
             kernel.test<4, true>();
         }
     }
+
+    // FP16 is converted with F16C instructions, so it is supported starting from avx2
+    {
+        jit_variable_load_store_test_kernel<ov::float16, float> kernel;
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            kernel.test<16, false>();
+            for (size_t length : {1, 7, 8, 15, 16}) {
+                kernel.test_tail<16, false>(length);
+                kernel.test_tail<16, false>(length, true);
+            }
+        }
+        if (mayiuse(cpu_isa_t::avx2)) {
+            kernel.test<8, false>();
+            for (size_t length : {1, 3, 4, 7, 8}) {
+                kernel.test_tail<8, false>(length);
+                kernel.test_tail<8, false>(length, true);
+            }
+        }
+    }
+
+    {
+        jit_variable_load_store_test_kernel<ov::float16, int32_t> kernel;
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            kernel.test<16, false>();
+            kernel.test_tail<16, false>(13);
+        }
+        if (mayiuse(cpu_isa_t::avx2)) {
+            kernel.test<8, false>();
+            kernel.test_tail<8, false>(5);
+        }
+    }
+
+    {
+        jit_variable_load_store_test_kernel<float, ov::float16> kernel;
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            kernel.test<16, true>();
+            for (size_t length : {1, 7, 8, 15, 16}) {
+                kernel.test_tail<16, true>(length);
+            }
+        }
+        if (mayiuse(cpu_isa_t::avx2)) {
+            kernel.test<8, true>();
+            for (size_t length : {1, 3, 4, 7, 8}) {
+                kernel.test_tail<8, true>(length);
+            }
+        }
+    }
+
+    {
+        jit_variable_load_store_test_kernel<int32_t, ov::float16> kernel;
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            kernel.test<16, true>();
+            kernel.test_tail<16, true>(13);
+        }
+        if (mayiuse(cpu_isa_t::avx2)) {
+            kernel.test<8, true>();
+            kernel.test_tail<8, true>(5);
+        }
+    }
 }
 
 }   // namespace
@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_transformations/op/fully_connected.hpp>
+#include <ngraph_transformations/fc_horizontal_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+class FullyConnectedHorizontalFusionTest : public TransformationTestsF {
+public:
+    FullyConnectedHorizontalFusionTest() {
+        comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+    }
+
+protected:
+    void SetUp() override {
+        TransformationTestsF::SetUp();
+        manager.register_pass<FullyConnectedHorizontalFusion>();
+    }
+};
+
+namespace {
+std::vector<float> concat(const std::vector<float>& lhs, const std::vector<float>& rhs) {
+    std::vector<float> result(lhs);
+    result.insert(result.end(), rhs.begin(), rhs.end());
+    return result;
+}
+
+std::vector<float> iota(size_t size, float start) {
+    std::vector<float> result(size);
+    for (size_t i = 0; i < size; i++)
+        result[i] = start + static_cast<float>(i);
+    return result;
+}
+}  // namespace
+
+TEST_F(FullyConnectedHorizontalFusionTest, FuseWithBias) {
+    const auto weights1Values = iota(64 * 64, 0.f), bias1Values = iota(64, 0.5f);
+    const auto weights2Values = iota(32 * 64, -100.f), bias2Values = iota(32, -0.5f);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 16, 64 });
+        auto weights1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 64, 64 }, weights1Values);
+        auto bias1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 64 }, bias1Values);
+        auto fc1 = std::make_shared<FullyConnectedNode>(input, weights1, bias1, ngraph::Rank(3));
+        auto weights2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 64 }, weights2Values);
+        auto bias2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32 }, bias2Values);
+        auto fc2 = std::make_shared<FullyConnectedNode>(input, weights2, bias2, ngraph::Rank(3));
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ fc1, fc2 }, ngraph::ParameterVector{ input });
+    }
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 16, 64 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 96, 64 },
+                                                        concat(weights1Values, weights2Values));
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 96 },
+                                                     concat(bias1Values, bias2Values));
+        auto fc = std::make_shared<FullyConnectedNode>(input, weights, bias, ngraph::Rank(3));
+        auto axis = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 2 });
+        auto lengths = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 64, 32 });
+        auto split = std::make_shared<ngraph::opset1::VariadicSplit>(fc, axis, lengths);
+
+        function_ref = std::make_shared<ngraph::Function>(split->outputs(), ngraph::ParameterVector{ input });
+    }
+}
+
+TEST_F(FullyConnectedHorizontalFusionTest, FuseWithoutBias) {
+    const auto weights1Values = iota(16 * 64, 1.f), weights2Values = iota(8 * 64, 2.f);
+    const auto weights3Values = iota(24 * 64, 3.f);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 16, 64 });
+        auto weights1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 16, 64 }, weights1Values);
+        auto fc1 = std::make_shared<FullyConnectedNode>(input, weights1, ngraph::Rank(2));
+        auto weights2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 8, 64 }, weights2Values);
+        auto fc2 = std::make_shared<FullyConnectedNode>(input, weights2, ngraph::Rank(2));
+        auto weights3 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 24, 64 }, weights3Values);
+        auto fc3 = std::make_shared<FullyConnectedNode>(input, weights3, ngraph::Rank(2));
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ fc1, fc2, fc3 },
+                                                      ngraph::ParameterVector{ input });
+    }
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 16, 64 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 48, 64 },
+                                                        concat(concat(weights1Values, weights2Values), weights3Values));
+        auto fc = std::make_shared<FullyConnectedNode>(input, weights, ngraph::Rank(2));
+        auto axis = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{}, { 1 });
+        auto lengths = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 3 }, { 16, 8, 24 });
+        auto split = std::make_shared<ngraph::opset1::VariadicSplit>(fc, axis, lengths);
+
+        function_ref = std::make_shared<ngraph::Function>(split->outputs(), ngraph::ParameterVector{ input });
+    }
+}
+
+// The negative cases keep the model unchanged, it is compared with its copy made before the transformation
+
+TEST_F(FullyConnectedHorizontalFusionTest, DifferentBiasPresenceNotFused) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 16, 64 });
+    auto weights1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 64, 64 }, { 1 });
+    auto fc1 = std::make_shared<FullyConnectedNode>(input, weights1, ngraph::Rank(2));
+    auto weights2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 64 }, { 2 });
+    auto bias2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32 }, { 2 });
+    auto fc2 = std::make_shared<FullyConnectedNode>(input, weights2, bias2, ngraph::Rank(2));
+
+    function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ fc1, fc2 }, ngraph::ParameterVector{ input });
+}
+
+TEST_F(FullyConnectedHorizontalFusionTest, DifferentInputsNotFused) {
+    auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 16, 64 });
+    auto weights1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 64, 64 }, { 1 });
+    auto fc1 = std::make_shared<FullyConnectedNode>(input1, weights1, ngraph::Rank(2));
+    auto input2 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 16, 64 });
+    auto weights2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 64 }, { 2 });
+    auto fc2 = std::make_shared<FullyConnectedNode>(input2, weights2, ngraph::Rank(2));
+
+    function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ fc1, fc2 },
+                                                  ngraph::ParameterVector{ input1, input2 });
+}
+
+TEST_F(FullyConnectedHorizontalFusionTest, NonConstantWeightsNotFused) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 16, 64 });
+    auto weights1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 64, 64 });
+    auto fc1 = std::make_shared<FullyConnectedNode>(input, weights1, ngraph::Rank(2));
+    auto weights2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 64 }, { 2 });
+    auto fc2 = std::make_shared<FullyConnectedNode>(input, weights2, ngraph::Rank(2));
+
+    function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ fc1, fc2 },
+                                                  ngraph::ParameterVector{ input, weights1 });
+}
+
+TEST_F(FullyConnectedHorizontalFusionTest, MismatchedInputChannelsNotFused) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 16, 64 });
+    auto weights1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 64, 64 }, { 1 });
+    auto fc1 = std::make_shared<FullyConnectedNode>(input, weights1, ngraph::Rank(2));
+    auto weights2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 32 }, { 2 });
+    auto fc2 = std::make_shared<FullyConnectedNode>(input, weights2, ngraph::Rank(2));
+
+    function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ fc1, fc2 }, ngraph::ParameterVector{ input });
+}
+
+TEST_F(FullyConnectedHorizontalFusionTest, FakeQuantizeConsumerNotFused) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 16, 64 });
+    auto weights1 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 64, 64 }, { 1 });
+    auto fc1 = std::make_shared<FullyConnectedNode>(input, weights1, ngraph::Rank(2));
+    auto weights2 = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 64 }, { 2 });
+    auto fc2 = std::make_shared<FullyConnectedNode>(input, weights2, ngraph::Rank(2));
+    auto low = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 0 });
+    auto high = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 255 });
+    auto fq = std::make_shared<ngraph::opset1::FakeQuantize>(fc2, low, high, low, high, 256);
+
+    function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ fc1, fq }, ngraph::ParameterVector{ input });
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "nodes/common/dynamic_quantization.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::vector<float> randomData(size_t size, float sigma, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::normal_distribution<float> distribution(0.f, sigma);
+    std::vector<float> data(size);
+    for (auto& value : data)
+        value = distribution(generator);
+    return data;
+}
+}  // namespace
+
+TEST(DynamicQuantizationTests, ActivationsRoundTrip) {
+    const size_t rows = 5, cols = 77;
+    auto src = randomData(rows * cols, 3.f, 1);
+    std::fill(src.begin(), src.begin() + cols, 0.f);  // zero row
+
+    std::vector<uint8_t> dst(rows * cols);
+    std::vector<float> scales(rows);
+    quantizeActivationsPerRow(src.data(), rows, cols, dst.data(), scales.data());
+
+    for (size_t row = 0; row < rows; row++) {
+        ASSERT_GT(scales[row], 0.f);
+        for (size_t i = 0; i < cols; i++) {
+            const size_t idx = row * cols + i;
+            ASSERT_GE(dst[idx], 1);
+            ASSERT_NEAR((static_cast<int>(dst[idx]) - 128) * scales[row], src[idx], scales[row] / 2 + 1e-6f);
+        }
+    }
+}
+
+TEST(DynamicQuantizationTests, GemmMatchesFP32) {
+    const size_t M = 7, N = 33, K = 130;
+    const auto src = randomData(M * K, 1.f, 2);
+    const auto weights = randomData(N * K, 0.1f, 3);
+    const auto bias = randomData(N, 1.f, 4);
+
+    std::vector<uint8_t> qSrc(M * K);
+    std::vector<float> srcScales(M);
+    quantizeActivationsPerRow(src.data(), M, K, qSrc.data(), srcScales.data());
+    std::vector<int8_t> qWeights(N * K);
+    std::vector<float> weiScales(N);
+    quantizeWeightsPerRow(weights.data(), N, K, qWeights.data(), weiScales.data());
+
+    std::vector<int32_t> acc(M * N);
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            int32_t sum = 0;
+            for (size_t k = 0; k < K; k++)
+                sum += (static_cast<int32_t>(qSrc[m * K + k]) - 128) * qWeights[n * K + k];
+            acc[m * N + n] = sum;
+        }
+    }
+    std::vector<float> dst(M * N);
+    dequantizeAccumulators(acc.data(), M, N, srcScales.data(), weiScales.data(), bias.data(), dst.data());
+
+    std::vector<float> ref(M * N);
+    float refMax = 0.f;
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            float sum = bias[n];
+            for (size_t k = 0; k < K; k++)
+                sum += src[m * K + k] * weights[n * K + k];
+            ref[m * N + n] = sum;
+            refMax = std::max(refMax, std::abs(sum));
+        }
+    }
+
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_NEAR(dst[i], ref[i], 0.02f * refMax) << "index: " << i;
+}
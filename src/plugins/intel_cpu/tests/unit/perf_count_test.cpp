@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "perf_count.h"
+
+using namespace ov::intel_cpu;
+
+TEST(PerfHistogramTests, PercentilesOfUniformDistribution) {
+    PerfHistogram histogram;
+    ASSERT_EQ(histogram.percentile(50), 0);
+
+    constexpr uint64_t maxTicks = 100000;
+    for (uint64_t ticks = 1; ticks <= maxTicks; ticks++) {
+        histogram.add(ticks);
+    }
+    for (const double percent : {10.0, 50.0, 90.0, 99.0}) {
+        const double expected = PerfClock::ticksToNs(static_cast<uint64_t>(maxTicks * percent / 100));
+        ASSERT_NEAR(histogram.percentile(percent), expected, expected * 0.05) << "percent: " << percent;
+    }
+}
+
+TEST(PerfHistogramTests, SmallDurationsAreExact) {
+    PerfHistogram histogram;
+    for (uint64_t ticks = 0; ticks < 10; ticks++) {
+        histogram.add(ticks);
+    }
+    ASSERT_DOUBLE_EQ(histogram.percentile(100), PerfClock::ticksToNs(9));
+}
+
+TEST(PerfCountTests, CollectsOnlyWhenNeeded) {
+    struct {
+        PerfCount counter;
+        PerfCount& PerfCounter() { return counter; }
+    } node, *nodePtr = &node;
+
+    for (int i = 0; i < 10; i++) {
+        PERF(nodePtr, i % 2 == 0);
+    }
+    ASSERT_EQ(node.counter.count(), 5);
+    ASSERT_LE(node.counter.percentileNs(50), node.counter.percentileNs(99));
+    ASSERT_GE(node.counter.lastFinish(), node.counter.lastStart());
+}
+
+TEST(PerfTraceTests, AppendsEventsToValidJson) {
+    const std::string file = "perf_trace_test.json";
+    const auto read = [&file] {
+        std::ifstream stream(file);
+        std::stringstream content;
+        content << stream.rdbuf();
+        return content.str();
+    };
+
+    appendPerfTrace(file, "");
+    ASSERT_EQ("{\"traceEvents\": [\n\n]}\n", read());
+    appendPerfTrace(file, "{\"name\": \"a\"}");
+    appendPerfTrace(file, "{\"name\": \"b\"},\n{\"name\": \"c\"}");
+    ASSERT_EQ("{\"traceEvents\": [\n{\"name\": \"a\"},\n{\"name\": \"b\"},\n{\"name\": \"c\"}\n]}\n", read());
+    std::remove(file.c_str());
+}
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <mutex>
+
+#include <dnnl.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <openvino/opsets/opset9.hpp>
+
+#include "cache/primitive_cache_reservation.h"
+#include "graph.h"
+
+using namespace ov::intel_cpu;
+
+// oneDNN testing API, returns the number of primitives in the primitive cache
+extern "C" dnnl_status_t dnnl_impl_get_primitive_cache_size(int* size);
+
+namespace {
+int primitiveCacheSize() {
+    int size = 0;
+    EXPECT_EQ(dnnl_success, dnnl_impl_get_primitive_cache_size(&size));
+    return size;
+}
+
+std::shared_ptr<const ov::Model> makeConvolutions() {
+    auto param = std::make_shared<ov::opset9::Parameter>(ov::element::f32, ov::Shape{1, 16, 14, 14});
+    std::shared_ptr<ov::Node> output = param;
+    for (size_t i = 0; i < 3; i++) {
+        output = ngraph::builder::makeConvolution(output, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1},
+                                                  {1, 1}, ov::op::PadType::EXPLICIT, 16);
+        output = std::make_shared<ov::opset9::Relu>(output);
+    }
+    auto result = std::make_shared<ov::opset9::Result>(output);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+// graph of a stream, the streams share the weights cache like the ones of a compiled model
+std::unique_ptr<Graph> makeStreamGraph(const std::shared_ptr<const ov::Model>& model,
+                                       const WeightsSharing::Ptr& weightsCache,
+                                       const std::shared_ptr<std::mutex>& mutex) {
+    auto context = std::make_shared<GraphContext>(Config{}, std::make_shared<ExtensionManager>(), weightsCache,
+                                                  mutex, false);
+    std::unique_ptr<Graph> graph(new Graph());
+    graph->CreateGraph(model, context);
+    return graph;
+}
+
+class PrimitiveCacheCapacityRestorer {
+public:
+    PrimitiveCacheCapacityRestorer() : capacity(dnnl::get_primitive_cache_capacity()) {}
+    ~PrimitiveCacheCapacityRestorer() { dnnl::set_primitive_cache_capacity(capacity); }
+
+private:
+    int capacity;
+};
+}  // namespace
+
+TEST(PrimitiveCacheReservationTest, RestoresCapacityOnRelease) {
+    PrimitiveCacheCapacityRestorer restorer;
+    dnnl::set_primitive_cache_capacity(100);
+    {
+        PrimitiveCacheReservation first(50);
+        ASSERT_EQ(150, dnnl::get_primitive_cache_capacity());
+        {
+            PrimitiveCacheReservation second(20);
+            ASSERT_EQ(170, dnnl::get_primitive_cache_capacity());
+        }
+        ASSERT_EQ(150, dnnl::get_primitive_cache_capacity());
+    }
+    ASSERT_EQ(100, dnnl::get_primitive_cache_capacity());
+}
+
+TEST(PrimitiveCacheReservationTest, CapacityIsBounded) {
+    PrimitiveCacheCapacityRestorer restorer;
+    dnnl::set_primitive_cache_capacity(100);
+    {
+        PrimitiveCacheReservation first(PrimitiveCacheReservation::maxCapacity);
+        PrimitiveCacheReservation second(PrimitiveCacheReservation::maxCapacity);
+        ASSERT_EQ(PrimitiveCacheReservation::maxCapacity, dnnl::get_primitive_cache_capacity());
+    }
+    ASSERT_EQ(100, dnnl::get_primitive_cache_capacity());
+
+    // the capacity configured by the user isn't reduced
+    dnnl::set_primitive_cache_capacity(PrimitiveCacheReservation::maxCapacity + 1);
+    {
+        PrimitiveCacheReservation reservation(10);
+        ASSERT_EQ(PrimitiveCacheReservation::maxCapacity + 1, dnnl::get_primitive_cache_capacity());
+    }
+    ASSERT_EQ(PrimitiveCacheReservation::maxCapacity + 1, dnnl::get_primitive_cache_capacity());
+}
+
+TEST(PrimitiveCacheReservationTest, GraphsOfOtherStreamsHitCache) {
+    PrimitiveCacheCapacityRestorer restorer;
+    // no room without the reservation, so every primitive of the first graph would be evicted
+    dnnl::set_primitive_cache_capacity(0);
+
+    const auto model = makeConvolutions();
+    const auto weightsCache = std::make_shared<WeightsSharing>();
+    const auto mutex = std::make_shared<std::mutex>();
+    auto firstStream = makeStreamGraph(model, weightsCache, mutex);
+    ASSERT_TRUE(firstStream->IsReady());
+
+    PrimitiveCacheReservation reservation(static_cast<int>(2 * firstStream->GetNodes().size()));
+    // the primitives of the first graph are created again to be put into the reserved cache
+    auto secondStream = makeStreamGraph(model, weightsCache, mutex);
+    const int cached = primitiveCacheSize();
+    ASSERT_GT(cached, 0);
+
+    // misses would add primitives to the cache
+    for (size_t stream = 2; stream < 4; stream++) {
+        auto graph = makeStreamGraph(model, weightsCache, mutex);
+        ASSERT_TRUE(graph->IsReady());
+        ASSERT_EQ(cached, primitiveCacheSize()) << "stream: " << stream;
+    }
+}
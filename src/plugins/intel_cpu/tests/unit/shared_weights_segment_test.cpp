@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+#include "shared_weights_segment.h"
+
+#ifdef __linux__
+# include <sys/mman.h>
+# include <sys/wait.h>
+# include <unistd.h>
+
+using namespace ov::intel_cpu;
+
+namespace {
+constexpr size_t dataSize = 1024;
+constexpr size_t entriesNum = 8;
+
+// Every mapping of the segment stands for a separate process attached to it
+class SharedWeightsSegmentTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        name = "/ov_cpu_unit_test_" + std::to_string(getpid()) + "_" +
+               ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        shm_unlink(name.c_str());
+    }
+
+    void TearDown() override {
+        shm_unlink(name.c_str());
+    }
+
+    std::string name;
+};
+}  // namespace
+
+TEST_F(SharedWeightsSegmentTests, OpenAttachesToExistingSegment) {
+    auto first = SharedWeightsSegment::open(name, dataSize, entriesNum);
+    ASSERT_NE(nullptr, first);
+    auto second = SharedWeightsSegment::open(name, dataSize, entriesNum);
+    ASSERT_NE(nullptr, second);
+    // the layout of the segment must match the expected one
+    EXPECT_EQ(nullptr, SharedWeightsSegment::open(name, dataSize, entriesNum * 2));
+}
+
+TEST_F(SharedWeightsSegmentTests, PublishedDataIsVisibleInOtherMapping) {
+    auto writer = SharedWeightsSegment::open(name, dataSize, entriesNum);
+    auto reader = SharedWeightsSegment::open(name, dataSize, entriesNum);
+    ASSERT_NE(nullptr, writer);
+    ASSERT_NE(nullptr, reader);
+
+    const std::string data = "weights";
+    auto block = writer->acquire("key", data.size());
+    ASSERT_TRUE(block);
+    EXPECT_FALSE(block.isReady());
+    // the key is being written by an alive process
+    EXPECT_FALSE(reader->acquire("key", data.size()));
+
+    std::memcpy(block.data(), data.data(), data.size());
+    block.publish();
+
+    auto readBlock = reader->acquire("key", data.size());
+    ASSERT_TRUE(readBlock);
+    EXPECT_TRUE(readBlock.isReady());
+    EXPECT_EQ(data, std::string(static_cast<const char*>(readBlock.data()), data.size()));
+    // the same key with another size is not shared
+    EXPECT_FALSE(reader->acquire("key", data.size() + 1));
+}
+
+TEST_F(SharedWeightsSegmentTests, KeysAreClaimedOnce) {
+    auto first = SharedWeightsSegment::open(name, dataSize, entriesNum);
+    auto second = SharedWeightsSegment::open(name, dataSize, entriesNum);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+
+    for (size_t i = 0; i < entriesNum; i++) {
+        const auto key = "key" + std::to_string(i);
+        auto block = (i % 2 ? first : second)->acquire(key, 16);
+        ASSERT_TRUE(block) << key;
+        EXPECT_FALSE(block.isReady()) << key;
+        EXPECT_FALSE((i % 2 ? second : first)->acquire(key, 16)) << key;
+        block.publish();
+    }
+    // all the entries are taken
+    EXPECT_FALSE(first->acquire("one more key", 16));
+}
+
+TEST_F(SharedWeightsSegmentTests, StaleWriterIsTakenOver) {
+    auto segment = SharedWeightsSegment::open(name, dataSize, entriesNum);
+    ASSERT_NE(nullptr, segment);
+
+    const pid_t child = fork();
+    ASSERT_NE(-1, child);
+    if (child == 0) {
+        // the writer dies without publishing the data
+        auto childSegment = SharedWeightsSegment::open(name, dataSize, entriesNum);
+        _exit(childSegment && childSegment->acquire("key", 16) ? 0 : 1);
+    }
+    int status = 0;
+    ASSERT_EQ(child, waitpid(child, &status, 0));
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(0, WEXITSTATUS(status));
+
+    auto block = segment->acquire("key", 16);
+    ASSERT_TRUE(block);
+    EXPECT_FALSE(block.isReady());
+    block.publish();
+    EXPECT_TRUE(segment->acquire("key", 16).isReady());
+}
+
+TEST_F(SharedWeightsSegmentTests, FullSegmentKeepsDataInProcess) {
+    auto first = SharedWeightsSegment::open(name, dataSize, entriesNum);
+    auto second = SharedWeightsSegment::open(name, dataSize, entriesNum);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+
+    EXPECT_FALSE(first->acquire("big", dataSize + 1));
+    // the key without data is neither waited for nor taken over
+    EXPECT_FALSE(second->acquire("big", dataSize + 1));
+
+    auto block = second->acquire("small", dataSize / 2);
+    EXPECT_TRUE(block);
+}
+
+#endif  // __linux__
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+class TableDataHash : public SimpleDataHash {
+public:
+    TableDataHash() { useCrcInstruction = false; }
+};
+
+// the byte-at-a-time CRC64 (ECMA-182) used to hash weights before
+class Crc64DataHash {
+public:
+    Crc64DataHash() {
+        for (int i = 0; i < 256; i++) {
+            uint64_t c = i;
+            for (int j = 0; j < 8; j++)
+                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+            table[i] = c;
+        }
+    }
+
+    uint64_t hash(const unsigned char* data, size_t size) const {
+        uint64_t crc = 0;
+        for (size_t idx = 0; idx < size; idx++)
+            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+        return ~crc;
+    }
+
+private:
+    uint64_t table[256];
+};
+
+// hashes the whole buffer as a single chunk, i.e. on one thread
+class SingleThreadDataHash : public SimpleDataHash {
+public:
+    explicit SingleThreadDataHash(bool crcInstruction) { useCrcInstruction = useCrcInstruction && crcInstruction; }
+
+    uint64_t hash(const unsigned char* data, size_t size) const {
+        return hashChunk(data, size);
+    }
+};
+
+template <typename Hash>
+double hashingTimeMs(const Hash& hash, const std::vector<unsigned char>& data) {
+    const auto start = std::chrono::steady_clock::now();
+    const volatile uint64_t value = hash.hash(data.data(), data.size());
+    (void)value;
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<unsigned char> randomData(size_t size) {
+    std::mt19937 generator(42);
+    std::vector<unsigned char> data(size);
+    for (auto& value : data)
+        value = static_cast<unsigned char>(generator());
+    return data;
+}
+}  // namespace
+
+TEST(SimpleDataHashTests, TableMatchesCrcInstruction) {
+    const SimpleDataHash hash;
+    const TableDataHash tableHash;
+    // sizes cover tails of every lane and several parallel chunks
+    const auto data = randomData(3 * 1024 * 1024 + 37);
+    for (size_t size : std::vector<size_t>{0, 1, 7, 8, 31, 32, 33, 100, 1024 * 1024, data.size()}) {
+        ASSERT_EQ(hash.hash(data.data(), size), tableHash.hash(data.data(), size)) << "size: " << size;
+    }
+}
+
+TEST(SimpleDataHashTests, DependsOnEveryByte) {
+    const SimpleDataHash hash;
+    auto data = randomData(2 * 1024 * 1024 + 3);
+    const auto reference = hash.hash(data.data(), data.size());
+    ASSERT_EQ(reference, hash.hash(data.data(), data.size()));
+    for (size_t idx : std::vector<size_t>{0, 9, 1024 * 1024 + 17, data.size() - 1}) {
+        data[idx] ^= 1;
+        ASSERT_NE(reference, hash.hash(data.data(), data.size())) << "index: " << idx;
+        data[idx] ^= 1;
+    }
+    ASSERT_NE(reference, hash.hash(data.data(), data.size() - 1));
+}
+
+// Compares hashing of 256MB of weights with the previous CRC64, run manually with
+// --gtest_also_run_disabled_tests --gtest_filter=*DISABLED_HashingTime*
+TEST(SimpleDataHashTests, DISABLED_HashingTime) {
+    const auto data = randomData(256 * 1024 * 1024);
+    std::cout << "CRC64 byte at a time: " << hashingTimeMs(Crc64DataHash(), data) << " ms" << std::endl;
+    std::cout << "CRC32C table, one thread: " << hashingTimeMs(SingleThreadDataHash(false), data) << " ms" << std::endl;
+    std::cout << "CRC32C instruction, one thread: " << hashingTimeMs(SingleThreadDataHash(true), data) << " ms"
+              << std::endl;
+    std::cout << "CRC32C instruction, parallel chunks: " << hashingTimeMs(SimpleDataHash(), data) << " ms"
+              << std::endl;
+}
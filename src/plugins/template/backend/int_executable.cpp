@@ -47,11 +47,33 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
       m_performance_counters_enabled{enable_performance_collection} {
     m_function = clone_function(*function);
     for (auto node : m_function->get_ordered_ops()) {
+        for (const auto& input : node->inputs()) {
+            m_tensor_last_use[input.get_tensor_ptr()] = m_nodes.size();
+        }
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
 }
 
+shared_ptr<HostTensor> runtime::interpreter::INTExecutable::get_intermediate_tensor(const Output<Node>& output) {
+    // Outputs with dynamic shapes are allocated by the evaluate itself
+    if (output.get_partial_shape().is_static()) {
+        auto it = m_tensor_pool.find({output.get_element_type(), output.get_shape()});
+        if (it != m_tensor_pool.end() && !it->second.empty()) {
+            auto host_tensor = it->second.back();
+            it->second.pop_back();
+            return host_tensor;
+        }
+    }
+    return make_shared<HostTensor>(output);
+}
+
+void runtime::interpreter::INTExecutable::release_intermediate_tensor(const shared_ptr<HostTensor>& tensor) {
+    if (tensor->get_partial_shape().is_static()) {
+        m_tensor_pool[{tensor->get_element_type(), tensor->get_shape()}].push_back(tensor);
+    }
+}
+
 bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                                const vector<shared_ptr<runtime::Tensor>>& inputs) {
     // convert inputs to HostTensor
@@ -73,6 +95,8 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
 
     // map function params -> HostTensor
     std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, shared_ptr<HostTensor>> tensor_map;
+    // intermediate tensors which are owned by the executable and can be returned to the pool
+    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, shared_ptr<HostTensor>> intermediate_map;
     size_t input_count = 0;
     for (const auto& param : get_parameters()) {
         for (size_t i = 0; i < param->get_output_size(); ++i) {
@@ -80,6 +104,7 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             tensor_map.insert({tensor, func_inputs[input_count++]});
         }
     }
+    tensor_map.insert(m_constant_tensors.begin(), m_constant_tensors.end());
 
     std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, size_t> results_map;
     // map function outputs -> HostTensor
@@ -93,10 +118,15 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
     eval_context.emplace("VariableContext", variable_context);
 
     // for each ordered op in the graph
-    for (const auto& op : m_nodes) {
+    for (size_t node_idx = 0; node_idx < m_nodes.size(); ++node_idx) {
+        const auto& op = m_nodes[node_idx];
         if (dynamic_pointer_cast<op::Parameter>(op) != nullptr) {
             continue;
         }
+        const bool is_constant = ov::is_type<op::Constant>(op);
+        if (is_constant && m_constant_tensors.count(op->output(0).get_tensor_ptr())) {
+            continue;
+        }
 
         // get op inputs from map
         vector<shared_ptr<HostTensor>> op_inputs;
@@ -122,8 +152,12 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
                 host_tensor = func_outputs[results_map[tensor]];
             } else if (it == tensor_map.end()) {
                 // Use cloned_node to create HostTensor with static dimensions
-                host_tensor = make_shared<HostTensor>(cloned_node->output(i));
+                host_tensor = is_constant ? make_shared<HostTensor>(cloned_node->output(i))
+                                          : get_intermediate_tensor(cloned_node->output(i));
                 tensor_map.insert({tensor, host_tensor});
+                if (!is_constant) {
+                    intermediate_map.insert({tensor, host_tensor});
+                }
             } else {
                 host_tensor = it->second;
             }
@@ -169,6 +203,25 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         if (m_nan_check_enabled) {
             perform_nan_check(op_outputs, op.get());
         }
+        if (is_constant) {
+            m_constant_tensors.insert({op->output(0).get_tensor_ptr(), op_outputs[0]});
+        }
+
+        // Return intermediate tensors which have no more consumers to the pool
+        for (const auto& input : op->inputs()) {
+            auto tensor = input.get_tensor_ptr();
+            auto it = intermediate_map.find(tensor);
+            if (it != intermediate_map.end() && m_tensor_last_use.at(tensor) == node_idx) {
+                tensor_map.erase(tensor);
+                release_intermediate_tensor(it->second);
+                intermediate_map.erase(it);
+            }
+        }
+    }
+
+    // Tensors without consumers stay alive till the end of the call
+    for (const auto& intermediate : intermediate_map) {
+        release_intermediate_tensor(intermediate.second);
     }
 
     return true;
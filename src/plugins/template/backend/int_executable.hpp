@@ -6,6 +6,7 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <ngraph/runtime/host_tensor.hpp>
 #include <sstream>
@@ -59,6 +60,8 @@ protected:
     bool evaluate_node(const std::shared_ptr<Node>& node,
                        const HostTensorVector& outputs,
                        const HostTensorVector& inputs) const;
+    std::shared_ptr<HostTensor> get_intermediate_tensor(const Output<Node>& output);
+    void release_intermediate_tensor(const std::shared_ptr<HostTensor>& tensor);
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
     bool m_performance_counters_enabled = false;
@@ -67,6 +70,12 @@ protected:
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     NGRAPH_SUPPRESS_DEPRECATED_END
     std::vector<std::shared_ptr<Node>> m_nodes;
+    // index of the last node in m_nodes which reads the tensor, used to release intermediate tensors early
+    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, size_t> m_tensor_last_use;
+    // constant outputs are evaluated once and kept for subsequent calls
+    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, std::shared_ptr<HostTensor>> m_constant_tensors;
+    // released intermediate tensors which are reused within a call and across calls
+    std::map<std::pair<element::Type, Shape>, std::vector<std::shared_ptr<HostTensor>>> m_tensor_pool;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&, const Node* op = nullptr);
     struct InfoForNMS5 {
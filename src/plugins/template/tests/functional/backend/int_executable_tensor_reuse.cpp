@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "int_executable.hpp"
+#include "openvino/opsets/opset8.hpp"
+
+using namespace ngraph;
+
+namespace {
+
+class ObservedExecutable : public runtime::interpreter::INTExecutable {
+public:
+    using INTExecutable::INTExecutable;
+
+    std::set<const void*> pooled_buffers() const {
+        std::set<const void*> buffers;
+        for (const auto& tensors : m_tensor_pool) {
+            for (const auto& tensor : tensors.second)
+                buffers.insert(tensor->get_data_ptr());
+        }
+        return buffers;
+    }
+
+    size_t cached_constants() const {
+        return m_constant_tensors.size();
+    }
+};
+
+// Parameter -> Add(c1) -> Multiply(c2) -> Add(c1) -> Relu -> Result
+std::shared_ptr<ov::Model> create_chain() {
+    auto data = std::make_shared<ov::opset8::Parameter>(element::f32, Shape{2, 3});
+    auto c1 = ov::opset8::Constant::create(element::f32, Shape{1}, {1.f});
+    auto c2 = ov::opset8::Constant::create(element::f32, Shape{2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+    auto add = std::make_shared<ov::opset8::Add>(data, c1);
+    auto multiply = std::make_shared<ov::opset8::Multiply>(add, c2);
+    auto add2 = std::make_shared<ov::opset8::Add>(multiply, c1);
+    auto relu = std::make_shared<ov::opset8::Relu>(add2);
+    return std::make_shared<ov::Model>(ov::NodeVector{relu}, ov::ParameterVector{data});
+}
+
+std::vector<float> reference(const std::vector<float>& input) {
+    const std::vector<float> c2 = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+    std::vector<float> output(input.size());
+    for (size_t i = 0; i < input.size(); i++)
+        output[i] = std::max(0.f, (input[i] + 1.f) * c2[i] + 1.f);
+    return output;
+}
+
+std::vector<float> infer(ObservedExecutable& executable, const std::vector<float>& input) {
+    auto input_tensor = std::make_shared<runtime::HostTensor>(element::f32, Shape{2, 3});
+    std::copy(input.begin(), input.end(), input_tensor->get_data_ptr<float>());
+    auto output_tensor = std::make_shared<runtime::HostTensor>(element::f32, Shape{2, 3});
+    EXPECT_TRUE(executable.call({output_tensor}, {input_tensor}));
+    const auto output = output_tensor->get_data_ptr<float>();
+    return std::vector<float>(output, output + shape_size(output_tensor->get_shape()));
+}
+
+}  // namespace
+
+TEST(TemplateBackendTensorReuse, IntermediateTensorsAreReusedAcrossCalls) {
+    ObservedExecutable executable(create_chain());
+
+    const std::vector<float> input = {-3.f, -2.f, -1.f, 0.f, 1.f, 2.f};
+    ASSERT_EQ(reference(input), infer(executable, input));
+    // four intermediate tensors share two buffers, each is released right after its last consumer
+    const auto buffers = executable.pooled_buffers();
+    ASSERT_EQ(2u, buffers.size());
+
+    ASSERT_EQ(reference(input), infer(executable, input));
+    ASSERT_EQ(buffers, executable.pooled_buffers());
+}
+
+TEST(TemplateBackendTensorReuse, CachedConstantsGiveCorrectResults) {
+    ObservedExecutable executable(create_chain());
+
+    const std::vector<float> first = {-3.f, -2.f, -1.f, 0.f, 1.f, 2.f};
+    ASSERT_EQ(reference(first), infer(executable, first));
+    ASSERT_EQ(2u, executable.cached_constants());
+
+    // the pooled tensors keep the values of the previous call, the cached constants must not be overwritten
+    const std::vector<float> second = {5.f, -7.f, 0.5f, 10.f, -0.25f, 3.f};
+    ASSERT_EQ(reference(second), infer(executable, second));
+    ASSERT_EQ(reference(first), infer(executable, first));
+    ASSERT_EQ(2u, executable.cached_constants());
+}
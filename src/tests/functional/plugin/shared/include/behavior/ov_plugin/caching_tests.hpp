@@ -70,6 +70,7 @@ using compileModelLoadFromFileParams = std::tuple<
 class CompileModelLoadFromFileTestBase : public testing::WithParamInterface<compileModelLoadFromFileParams>,
                                   virtual public SubgraphBaseTest,
                                   virtual public OVPluginTestBase {
+protected:
     std::string m_cacheFolderName;
     std::string m_modelName;
     std::string m_weightsName;
@@ -80,6 +81,7 @@ public:
     void SetUp() override;
     void TearDown() override;
     void run() override;
+    bool importExportSupported(ov::Core &core) const;
 };
 
 using compileModelLoadFromMemoryParams = std::tuple<std::string,  // device name
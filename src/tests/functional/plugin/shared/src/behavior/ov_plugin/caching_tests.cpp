@@ -4,6 +4,8 @@
 
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <future>
 #include <thread>
 
 #include "behavior/ov_plugin/caching_tests.hpp"
@@ -321,6 +323,77 @@ TEST_P(CompileModelLoadFromFileTestBase, CanLoadFromFileWithoutExecption) {
     run();
 }
 
+bool CompileModelLoadFromFileTestBase::importExportSupported(ov::Core& core) const {
+    auto supportedProperties = core.get_property(targetDevice, ov::supported_properties);
+    if (std::find(supportedProperties.begin(), supportedProperties.end(), ov::device::capabilities) ==
+        supportedProperties.end()) {
+        return false;
+    }
+    auto device_capabilities = core.get_property(targetDevice, ov::device::capabilities);
+    if (std::find(device_capabilities.begin(),
+                  device_capabilities.end(),
+                  std::string(ov::device::capability::EXPORT_IMPORT)) == device_capabilities.end()) {
+        return false;
+    }
+    return true;
+}
+
+TEST_P(CompileModelLoadFromFileTestBase, CanCompileModelAsync) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const size_t numModels = 4;
+    auto threads = core->get_property("", ov::compile_model_async_threads);
+    core->set_property(ov::compile_model_async_threads(numModels));
+    auto compileAll = [&] {
+        std::vector<std::future<ov::CompiledModel>> futures;
+        for (size_t i = 0; i < numModels; i++) {
+            futures.push_back(core->compile_model_async(m_modelName, targetDevice, configuration));
+        }
+        std::vector<ov::CompiledModel> models;
+        for (auto& future : futures) {
+            models.push_back(future.get());
+        }
+        return models;
+    };
+
+    // without the cache the models are compiled independently: if they run at the same time,
+    // the phases measured on the pool threads add up to more than the wall time of the whole batch.
+    // The plugin is loaded and initialized by a synchronous compilation beforehand, so it isn't counted.
+    ASSERT_NO_THROW(core->compile_model(m_modelName, targetDevice, configuration));
+    std::vector<ov::CompiledModel> models;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_NO_THROW(models = compileAll());
+    auto wallTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    float busyTime = 0;
+    for (auto& model : models) {
+        auto loadingTime = model.get_property(ov::loading_time_details);
+        ASSERT_EQ(1, loadingTime.count("QUEUE"));
+        ASSERT_EQ(1, loadingTime.count("COMPILE"));
+        ASSERT_EQ(0, loadingTime.count("CACHE_READ"));
+        for (const auto& phase : loadingTime) {
+            if (phase.first != "QUEUE")
+                busyTime += phase.second;
+        }
+    }
+    EXPECT_LT(wallTime, busyTime) << "Models were not compiled concurrently";
+
+    // with the cache the first compilation writes the blob while the others wait for it and import it
+    core->set_property(ov::cache_dir(m_cacheFolderName));
+    ASSERT_NO_THROW(models = compileAll());
+    size_t compiled = 0, imported = 0;
+    for (auto& model : models) {
+        auto loadingTime = model.get_property(ov::loading_time_details);
+        ASSERT_EQ(1, loadingTime.count("QUEUE"));
+        compiled += loadingTime.count("COMPILE");
+        imported += loadingTime.count("CACHE_READ");
+        ASSERT_NO_THROW(model.create_infer_request().infer());
+    }
+    ASSERT_EQ(numModels, compiled + imported);
+    if (importExportSupported(*core)) {
+        ASSERT_EQ(1, compiled);
+    }
+    core->set_property(ov::compile_model_async_threads(threads));
+}
+
 std::string CompileModelLoadFromMemoryTestBase::getTestCaseName(
     testing::TestParamInfo<compileModelLoadFromMemoryParams> obj) {
     auto param = obj.param;
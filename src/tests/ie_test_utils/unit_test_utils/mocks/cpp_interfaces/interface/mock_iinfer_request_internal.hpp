@@ -6,6 +6,7 @@
 
 #include <gmock/gmock.h>
 
+#include <chrono>
 #include <map>
 #include <string>
 #include <vector>
@@ -28,6 +29,7 @@ public:
     MOCK_METHOD1(SetBatch, void(int));
     MOCK_METHOD0(QueryState, std::vector<InferenceEngine::IVariableStateInternal::Ptr>());
     MOCK_METHOD0(Cancel, void());
+    MOCK_METHOD3(SetSchedulingHint, void(ov::hint::Priority, std::chrono::milliseconds, bool));
     MOCK_METHOD0(StartAsyncImpl, void());
     MOCK_METHOD0(InferImpl, void());
     MOCK_METHOD0(checkBlobs, void());
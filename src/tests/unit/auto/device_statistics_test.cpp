@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "common.hpp"
+
+using MockMultiDevicePlugin::DeviceStatistics;
+
+TEST(DeviceStatisticsTest, noSamplesGivesZeroExpectedCompletion) {
+    DeviceStatistics statistics;
+    EXPECT_DOUBLE_EQ(0.0, statistics.ExpectedCompletion(4));
+}
+
+TEST(DeviceStatisticsTest, firstSampleInitializesAverage) {
+    DeviceStatistics statistics;
+    statistics.OnStart();
+    statistics.OnFinish(10.0);
+    EXPECT_DOUBLE_EQ(10.0, statistics._latencyEwma);
+    EXPECT_EQ(1u, statistics._completed);
+    EXPECT_EQ(0u, statistics._inFlight);
+}
+
+TEST(DeviceStatisticsTest, averageFollowsSamples) {
+    DeviceStatistics statistics;
+    statistics.OnStart();
+    statistics.OnFinish(10.0);
+    statistics.OnStart();
+    statistics.OnFinish(20.0);
+    const double expected = DeviceStatistics::latencyEwmaFactor * 20.0 +
+                            (1.0 - DeviceStatistics::latencyEwmaFactor) * 10.0;
+    EXPECT_DOUBLE_EQ(expected, statistics._latencyEwma);
+}
+
+TEST(DeviceStatisticsTest, expectedCompletionAccountsForInFlightAndWorkers) {
+    DeviceStatistics fast, slow;
+    fast.OnStart();
+    fast.OnFinish(5.0);
+    slow.OnStart();
+    slow.OnFinish(20.0);
+    // two requests are already running on the fast device with two worker requests
+    fast.OnStart();
+    fast.OnStart();
+    EXPECT_DOUBLE_EQ(7.5, fast.ExpectedCompletion(2));
+    EXPECT_DOUBLE_EQ(10.0, slow.ExpectedCompletion(2));
+    EXPECT_LT(fast.ExpectedCompletion(2), slow.ExpectedCompletion(2));
+}
+
+TEST(DeviceStatisticsTest, toAnyMap) {
+    DeviceStatistics statistics;
+    statistics.OnStart();
+    statistics.OnFinish(3.0);
+    statistics.OnStart();
+    auto map = statistics.ToAnyMap();
+    EXPECT_EQ(1u, map.at("COMPLETED").as<uint64_t>());
+    EXPECT_EQ(1u, map.at("IN_FLIGHT").as<uint64_t>());
+    EXPECT_DOUBLE_EQ(3.0, map.at("LATENCY_EWMA_MS").as<double>());
+}
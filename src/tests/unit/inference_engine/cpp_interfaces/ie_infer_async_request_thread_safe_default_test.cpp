@@ -3,6 +3,7 @@
 //
 
 #include <deque>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -194,3 +195,115 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+// SetSchedulingHint
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetSchedulingHint) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_THROW(testRequest->SetSchedulingHint(ov::hint::Priority::HIGH, std::chrono::milliseconds{0}, false),
+                 RequestBusy);
+    taskExecutor->executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, expiredRequestIsDroppedIfRequested) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    testRequest->SetSchedulingHint(ov::hint::Priority::LOW, std::chrono::milliseconds{1}, true);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(0);
+    testRequest->StartAsync();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    taskExecutor->executeAll();
+    EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), InferCancelled);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, expiredRequestIsExecutedIfNotRequestedToDrop) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    testRequest->SetSchedulingHint(ov::hint::Priority::LOW, std::chrono::milliseconds{1}, false);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    testRequest->StartAsync();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    taskExecutor->executeAll();
+    ASSERT_NO_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+namespace {
+// runs inference on the task executor and then a postprocessing stage on its own executor,
+// like a device request with the output conversion offloaded
+struct TwoStagesAsyncInferRequest : public AsyncInferRequestThreadSafeDefault {
+    TwoStagesAsyncInferRequest(const IInferRequestInternal::Ptr& request,
+                               const ITaskExecutor::Ptr& taskExecutor,
+                               const ITaskExecutor::Ptr& postprocessExecutor)
+        : AsyncInferRequestThreadSafeDefault(request, taskExecutor, taskExecutor) {
+        _pipeline.emplace_back(postprocessExecutor, [this] {
+            postprocessed = true;
+        });
+    }
+
+    ~TwoStagesAsyncInferRequest() {
+        StopAndWait();
+    }
+
+    using AsyncInferRequestThreadSafeDefault::ForwardSchedulingHint;
+
+    bool postprocessed = false;
+};
+}  // namespace
+
+TEST_F(InferRequestThreadSafeDefaultTests, requestExpiredDuringInferenceIsCompleted) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto postprocessExecutor = std::make_shared<DeferedExecutor>();
+    auto request = make_shared<TwoStagesAsyncInferRequest>(mockInferRequestInternal, taskExecutor, postprocessExecutor);
+    request->SetSchedulingHint(ov::hint::Priority::HIGH, std::chrono::milliseconds{5}, true);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1).WillOnce(Invoke([] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    }));
+    request->StartAsync();
+    taskExecutor->executeOne();
+    // the deadline is expired when the postprocessing starts
+    postprocessExecutor->executeAll();
+    taskExecutor->executeAll();
+    ASSERT_NO_THROW(request->Wait(InferRequest::WaitMode::RESULT_READY));
+    ASSERT_TRUE(request->postprocessed);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, schedulingHintIsForwardedWithTimeLeft) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto request = make_shared<TwoStagesAsyncInferRequest>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    auto deviceRequest = make_shared<MockIInferRequestInternal>(InputsDataMap{}, OutputsDataMap{});
+    request->SetSchedulingHint(ov::hint::Priority::HIGH, std::chrono::milliseconds{10000}, true);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    request->StartAsync();
+    EXPECT_CALL(*deviceRequest.get(),
+                SetSchedulingHint(ov::hint::Priority::HIGH,
+                                  AllOf(Gt(std::chrono::milliseconds{0}), Le(std::chrono::milliseconds{10000})),
+                                  true))
+        .Times(1);
+    request->ForwardSchedulingHint(*deviceRequest);
+    // requests started after other requests of the inference must complete it
+    EXPECT_CALL(*deviceRequest.get(), SetSchedulingHint(ov::hint::Priority::HIGH, _, false)).Times(1);
+    request->ForwardSchedulingHint(*deviceRequest, true);
+    taskExecutor->executeAll();
+    ASSERT_NO_THROW(request->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, expiredSchedulingHintIsForwardedAsExpired) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto deviceExecutor = std::make_shared<DeferedExecutor>();
+    auto request = make_shared<TwoStagesAsyncInferRequest>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    auto deviceRequest = make_shared<AsyncInferRequestThreadSafeDefault>(
+        make_shared<MockIInferRequestInternal>(InputsDataMap{}, OutputsDataMap{}), deviceExecutor, deviceExecutor);
+    request->SetSchedulingHint(ov::hint::Priority::LOW, std::chrono::milliseconds{1}, true);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    request->StartAsync();
+    taskExecutor->executeOne();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    request->ForwardSchedulingHint(*deviceRequest);
+    deviceRequest->StartAsync();
+    deviceExecutor->executeAll();
+    EXPECT_THROW(deviceRequest->Wait(InferRequest::WaitMode::RESULT_READY), InferCancelled);
+    taskExecutor->executeAll();
+    ASSERT_NO_THROW(request->Wait(InferRequest::WaitMode::RESULT_READY));
+}
@@ -17,6 +17,7 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
 #include <chrono>
@@ -698,6 +699,87 @@ TEST_P(ConvertDepthTestGAPI, AccuracyTest)
     }
 }
 
+TEST_P(ConvertNormalizedI8TestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int in_depth      = std::get<0>(params);
+    cv::Size sz       = std::get<1>(params);
+    double tolerance  = std::get<2>(params);
+
+    const double mean  = 127.5;
+    const double scale = 0.75;
+
+    initMatrixRandU(CV_MAKETYPE(in_depth,1), sz, CV_8SC1);
+
+    // G-API code //////////////////////////////////////////////////////////////
+    ConvertNormalizedComputation cc(to_test(in_mat1), to_test(out_mat_gapi), mean, scale, CV_8S);
+    cc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ cc.apply(); },
+        400, "ConvNormalized GAPI %s to I8 %dx%d", depthToString(in_mat1.depth()).c_str(), sz.width, sz.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        in_mat1.convertTo(out_mat_ocv, CV_8SC1, scale, -mean * scale);
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
+
+TEST_P(ConvertNormalizedBF16TestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int in_depth      = std::get<0>(params);
+    cv::Size sz       = std::get<1>(params);
+    double tolerance  = std::get<2>(params);
+
+    const double mean  = 127.5;
+    const double scale = 0.75;
+
+    // bfloat16 values are stored as bit patterns in 16-bit unsigned planes
+    initMatrixRandU(CV_MAKETYPE(in_depth,1), sz, CV_16UC1);
+
+    // G-API code //////////////////////////////////////////////////////////////
+    ConvertNormalizedComputation cc(to_test(in_mat1), to_test(out_mat_gapi), mean, scale, CV_16U);
+    cc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ cc.apply(); },
+        400, "ConvNormalized GAPI %s to BF16 %dx%d", depthToString(in_mat1.depth()).c_str(), sz.width, sz.height);
+#endif
+
+    // Reference code //////////////////////////////////////////////////////////
+    {
+        // round to nearest even, the values are finite
+        auto to_bf16 = [](float value) {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            bits += 0x7FFF + ((bits >> 16) & 1);
+            return static_cast<uint16_t>(bits >> 16);
+        };
+
+        cv::Mat in_f32;
+        in_mat1.convertTo(in_f32, CV_32F);
+        for (int y = 0; y < sz.height; y++) {
+            const float* in = in_f32.ptr<float>(y);
+            uint16_t* out = out_mat_ocv.ptr<uint16_t>(y);
+            for (int x = 0; x < sz.width; x++) {
+                out[x] = to_bf16((in[x] - static_cast<float>(mean)) * static_cast<float>(scale));
+            }
+        }
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
+
 TEST_P(DivCTestGAPI, AccuracyTest)
 {
     const auto params       = GetParam();
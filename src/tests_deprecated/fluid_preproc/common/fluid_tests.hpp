@@ -25,6 +25,16 @@ struct ConvertDepthTestGAPI: public TestParams<std::tuple<
                             cv::Size,
                             double>>   // tolerance
 {};
+struct ConvertNormalizedI8TestGAPI: public TestParams<std::tuple<
+                            int,  // input matrix depth
+                            cv::Size,
+                            double>>   // tolerance
+{};
+struct ConvertNormalizedBF16TestGAPI: public TestParams<std::tuple<
+                            int,  // input matrix depth
+                            cv::Size,
+                            double>>   // tolerance
+{};
 struct DivCTestGAPI: public TestParams<std::tuple<
                             int,  // input matrix depth
                             int,  // input matrix channels number
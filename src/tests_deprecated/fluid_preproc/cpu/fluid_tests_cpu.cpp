@@ -183,6 +183,20 @@ INSTANTIATE_TEST_SUITE_P(ConvertDepthFluid, ConvertDepthTestGAPI,
                                        cv::Size( 320,  200)),
                                 Values(1)));
 
+INSTANTIATE_TEST_SUITE_P(ConvertNormalizedI8Fluid, ConvertNormalizedI8TestGAPI,
+                        Combine(Values(CV_8U, CV_32F),
+                                Values(cv::Size(1920, 1080),
+                                       cv::Size( 640,  480),
+                                       cv::Size( 300,  300)),
+                                Values(1)));
+
+INSTANTIATE_TEST_SUITE_P(ConvertNormalizedBF16Fluid, ConvertNormalizedBF16TestGAPI,
+                        Combine(Values(CV_8U, CV_32F),
+                                Values(cv::Size(1920, 1080),
+                                       cv::Size( 640,  480),
+                                       cv::Size( 300,  300)),
+                                Values(0)));
+
 INSTANTIATE_TEST_SUITE_P(DivCFluid, DivCTestGAPI,
                         Combine(Values(CV_32F),
                                 Values(1),      //channels
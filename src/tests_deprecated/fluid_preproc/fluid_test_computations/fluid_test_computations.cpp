@@ -264,6 +264,18 @@ ConvertDepthComputation::ConvertDepthComputation(test::Mat inMat, test::Mat outM
                                })
 {}
 
+ConvertNormalizedComputation::ConvertNormalizedComputation(test::Mat inMat, test::Mat outMat,
+                                                           double mean, double scale, int depth)
+    : FluidComputation(new Priv{ [mean, scale, depth]()-> cv::GComputation {
+                                      cv::GMat in;
+                                      cv::GMat out = InferenceEngine::gapi::ConvertNormalized::on(in, mean, scale, depth);
+                                      return cv::GComputation(cv::GIn(in), cv::GOut(out));
+                                  }()
+                               , to_own(inMat)
+                               , to_own(outMat)
+                               })
+{}
+
 DivCComputation::DivCComputation(test::Mat inMat, test::Mat outMat, test::Scalar const& c)
     : FluidComputation(new Priv{ []()-> cv::GComputation {
                                       cv::GMat in;
@@ -96,6 +96,12 @@ public:
     ConvertDepthComputation(test::Mat inMat, test::Mat outMat, int depth);
 };
 
+class ConvertNormalizedComputation : public FluidComputation
+{
+public:
+    ConvertNormalizedComputation(test::Mat inMat, test::Mat outMat, double mean, double scale, int depth);
+};
+
 class DivCComputation : public FluidComputation
 {
 public: